@@ -841,3 +841,202 @@ impl InstanceRaw {
         }
     }
 }
+
+/// One vertex of script-submitted line geometry. `color` is the packed 0xAABBGGRR word
+/// from `dropbear_queue_debug_lines`, unpacked to RGBA by the Unorm8x4 vertex format.
+#[repr(C)]
+#[derive(Copy, Clone, Debug, bytemuck::Pod, bytemuck::Zeroable)]
+pub struct ScriptGeometryVertex {
+    pub position: [f32; 3],
+    pub color: u32,
+}
+
+impl ScriptGeometryVertex {
+    pub fn desc() -> VertexBufferLayout<'static> {
+        VertexBufferLayout {
+            array_stride: size_of::<ScriptGeometryVertex>() as BufferAddress,
+            step_mode: wgpu::VertexStepMode::Vertex,
+            attributes: &[
+                wgpu::VertexAttribute {
+                    offset: 0,
+                    shader_location: 0,
+                    format: wgpu::VertexFormat::Float32x3,
+                },
+                wgpu::VertexAttribute {
+                    offset: size_of::<[f32; 3]>() as wgpu::BufferAddress,
+                    shader_location: 1,
+                    format: wgpu::VertexFormat::Unorm8x4,
+                },
+            ],
+        }
+    }
+}
+
+/// Draws the frame-scoped geometry scripts submit through `dropbear_queue_debug_lines`
+/// and `dropbear_queue_dynamic_mesh`. The caller combines every line batch into one
+/// vertex array and every mesh batch into one vertex/index pair, so the per-frame cost
+/// stays at a fixed number of buffer writes regardless of how many batches were queued.
+pub struct ScriptGeometryRenderer {
+    line_pipeline: RenderPipeline,
+    mesh_pipeline: RenderPipeline,
+}
+
+impl ScriptGeometryRenderer {
+    pub fn new(graphics: Arc<SharedGraphicsContext>, camera_layout: &BindGroupLayout) -> Self {
+        let shader = Shader::new(
+            graphics.clone(),
+            crate::shader::shader_wesl::SCRIPT_GEOMETRY_SHADER,
+            Some("script_geometry_shader"),
+        );
+
+        let pipeline_layout =
+            graphics
+                .device
+                .create_pipeline_layout(&wgpu::PipelineLayoutDescriptor {
+                    label: Some("Script Geometry Pipeline Layout"),
+                    bind_group_layouts: &[camera_layout],
+                    push_constant_ranges: &[],
+                });
+
+        let line_pipeline = Self::pipeline(
+            &graphics,
+            &pipeline_layout,
+            &shader,
+            "vs_line",
+            "fs_line",
+            ScriptGeometryVertex::desc(),
+            wgpu::PrimitiveTopology::LineList,
+            Some("Script Debug Line Pipeline"),
+        );
+        let mesh_pipeline = Self::pipeline(
+            &graphics,
+            &pipeline_layout,
+            &shader,
+            "vs_mesh",
+            "fs_mesh",
+            model::ModelVertex::desc(),
+            wgpu::PrimitiveTopology::TriangleList,
+            Some("Script Dynamic Mesh Pipeline"),
+        );
+        log::debug!("Created script geometry pipelines");
+
+        Self {
+            line_pipeline,
+            mesh_pipeline,
+        }
+    }
+
+    #[allow(clippy::too_many_arguments)]
+    fn pipeline(
+        graphics: &SharedGraphicsContext,
+        layout: &wgpu::PipelineLayout,
+        shader: &Shader,
+        vs_entry: &str,
+        fs_entry: &str,
+        vertex_layout: VertexBufferLayout<'static>,
+        topology: wgpu::PrimitiveTopology,
+        label: Option<&str>,
+    ) -> RenderPipeline {
+        graphics
+            .device
+            .create_render_pipeline(&wgpu::RenderPipelineDescriptor {
+                label,
+                layout: Some(layout),
+                vertex: wgpu::VertexState {
+                    module: &shader.module,
+                    entry_point: Some(vs_entry),
+                    buffers: &[vertex_layout],
+                    compilation_options: wgpu::PipelineCompilationOptions::default(),
+                },
+                fragment: Some(wgpu::FragmentState {
+                    module: &shader.module,
+                    entry_point: Some(fs_entry),
+                    targets: &[Some(wgpu::ColorTargetState {
+                        format: wgpu::TextureFormat::Rgba8Unorm,
+                        blend: Some(wgpu::BlendState::REPLACE),
+                        write_mask: wgpu::ColorWrites::ALL,
+                    })],
+                    compilation_options: wgpu::PipelineCompilationOptions::default(),
+                }),
+                primitive: wgpu::PrimitiveState {
+                    topology,
+                    strip_index_format: None,
+                    front_face: wgpu::FrontFace::Ccw,
+                    cull_mode: None,
+                    polygon_mode: wgpu::PolygonMode::Fill,
+                    unclipped_depth: false,
+                    conservative: false,
+                },
+                depth_stencil: Some(wgpu::DepthStencilState {
+                    format: Texture::DEPTH_FORMAT,
+                    depth_write_enabled: true,
+                    depth_compare: CompareFunction::Greater,
+                    stencil: StencilState::default(),
+                    bias: DepthBiasState::default(),
+                }),
+                multisample: wgpu::MultisampleState {
+                    count: 1,
+                    mask: !0,
+                    alpha_to_coverage_enabled: false,
+                },
+                multiview: None,
+                cache: None,
+            })
+    }
+
+    /// Uploads and draws this frame's script geometry in one pass: a single buffer write
+    /// for the lines and a single vertex/index write for the meshes.
+    /// `mesh_vertex_floats` is concatenated interleaved data in the
+    /// [`model::ModelVertex`] layout (8 floats per vertex) with indices already offset
+    /// into the combined array by the caller.
+    pub fn render(
+        &self,
+        graphics: &mut RenderContext,
+        camera_bind_group: &BindGroup,
+        line_vertices: &[ScriptGeometryVertex],
+        mesh_vertex_floats: &[f32],
+        mesh_indices: &[u32],
+    ) {
+        if line_vertices.is_empty() && mesh_indices.is_empty() {
+            return;
+        }
+
+        let device = graphics.shared.device.clone();
+        let line_buffer = (!line_vertices.is_empty()).then(|| {
+            device.create_buffer_init(&BufferInitDescriptor {
+                label: Some("Script Debug Line Buffer"),
+                contents: bytemuck::cast_slice(line_vertices),
+                usage: BufferUsages::VERTEX,
+            })
+        });
+        let mesh_buffers = (!mesh_indices.is_empty() && !mesh_vertex_floats.is_empty()).then(|| {
+            let vertex_buffer = device.create_buffer_init(&BufferInitDescriptor {
+                label: Some("Script Dynamic Mesh Vertex Buffer"),
+                contents: bytemuck::cast_slice(mesh_vertex_floats),
+                usage: BufferUsages::VERTEX,
+            });
+            let index_buffer = device.create_buffer_init(&BufferInitDescriptor {
+                label: Some("Script Dynamic Mesh Index Buffer"),
+                contents: bytemuck::cast_slice(mesh_indices),
+                usage: BufferUsages::INDEX,
+            });
+            (vertex_buffer, index_buffer)
+        });
+
+        let mut render_pass = graphics.continue_pass();
+        render_pass.set_bind_group(0, camera_bind_group, &[]);
+
+        if let Some(buffer) = &line_buffer {
+            render_pass.set_pipeline(&self.line_pipeline);
+            render_pass.set_vertex_buffer(0, buffer.slice(..));
+            render_pass.draw(0..line_vertices.len() as u32, 0..1);
+        }
+
+        if let Some((vertex_buffer, index_buffer)) = &mesh_buffers {
+            render_pass.set_pipeline(&self.mesh_pipeline);
+            render_pass.set_vertex_buffer(0, vertex_buffer.slice(..));
+            render_pass.set_index_buffer(index_buffer.slice(..), wgpu::IndexFormat::Uint32);
+            render_pass.draw_indexed(0..mesh_indices.len() as u32, 0, 0..1);
+        }
+    }
+}
@@ -31,4 +31,9 @@ fn main() {
         .build_artifact(&"package::shader".parse().unwrap(), "dropbear_shader");
     wesl::Wesl::new("src/shaders")
         .build_artifact(&"package::outline".parse().unwrap(), "dropbear_outline");
+    wesl::Wesl::new("src/shaders")
+        .build_artifact(
+            &"package::script_geometry".parse().unwrap(),
+            "dropbear_script_geometry",
+        );
 }
@@ -5,3 +5,4 @@ wesl::wesl_pkg!(dropbear);
 pub const LIGHT_SHADER: &str = include_wesl!("dropbear_light");
 pub const SHADER_SHADER: &str = include_wesl!("dropbear_shader");
 pub const OUTLINE_SHADER: &str = include_wesl!("dropbear_outline");
+pub const SCRIPT_GEOMETRY_SHADER: &str = include_wesl!("dropbear_script_geometry");
@@ -0,0 +1,59 @@
+// Script-submitted geometry (dropbear_queue_debug_lines / dropbear_queue_dynamic_mesh):
+// unlit vertex-coloured lines, and dynamic meshes flat-shaded with a fixed light so
+// their shape reads without a material binding.
+
+struct CameraUniform {
+    view_pos: vec4<f32>,
+    view_proj: mat4x4<f32>,
+};
+
+@group(0) @binding(0)
+var<uniform> camera: CameraUniform;
+
+struct LineInput {
+    @location(0) position: vec3<f32>,
+    @location(1) color: vec4<f32>,
+};
+
+struct LineOutput {
+    @builtin(position) clip_position: vec4<f32>,
+    @location(0) color: vec4<f32>,
+};
+
+@vertex
+fn vs_line(in: LineInput) -> LineOutput {
+    var out: LineOutput;
+    out.clip_position = camera.view_proj * vec4<f32>(in.position, 1.0);
+    out.color = in.color;
+    return out;
+}
+
+@fragment
+fn fs_line(in: LineOutput) -> @location(0) vec4<f32> {
+    return in.color;
+}
+
+struct MeshInput {
+    @location(0) position: vec3<f32>,
+    @location(1) tex_coords: vec2<f32>,
+    @location(2) normal: vec3<f32>,
+};
+
+struct MeshOutput {
+    @builtin(position) clip_position: vec4<f32>,
+    @location(0) normal: vec3<f32>,
+};
+
+@vertex
+fn vs_mesh(in: MeshInput) -> MeshOutput {
+    var out: MeshOutput;
+    out.clip_position = camera.view_proj * vec4<f32>(in.position, 1.0);
+    out.normal = in.normal;
+    return out;
+}
+
+@fragment
+fn fs_mesh(in: MeshOutput) -> @location(0) vec4<f32> {
+    let shade = 0.35 + 0.65 * max(dot(normalize(in.normal), normalize(vec3<f32>(0.4, 0.8, 0.3))), 0.0);
+    return vec4<f32>(vec3<f32>(0.8) * shade, 1.0);
+}
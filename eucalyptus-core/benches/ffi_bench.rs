@@ -0,0 +1,290 @@
+//! Microbenchmark for the native FFI exports that dominate script frame time.
+//!
+//! Runs as a plain `cargo bench -p eucalyptus-core --bench ffi_bench` target (no harness) so
+//! it can double as a regression gate: every measurement is checked against a generous
+//! absolute threshold and the process exits non-zero when one is blown, failing loudly
+//! before a regression reaches a shipped build. Thresholds can be scaled for slower CI
+//! machines with the `FFI_BENCH_SCALE` env var (e.g. `FFI_BENCH_SCALE=4`).
+//!
+//! The worlds are built with `Label`, `EntityTransform` and `ModelProperties` only —
+//! `MeshRenderer` needs a live GPU, so the property exports (which query `&MeshRenderer`)
+//! are exercised on their miss path here and `ModelProperties` is benched directly for the
+//! hit path.
+
+use eucalyptus_core::input::InputState;
+use eucalyptus_core::scripting::native::exports::*;
+use eucalyptus_core::scripting::native::types::{
+    NativeEntityTransform, NativeInputSnapshot, NativeTransform,
+};
+use eucalyptus_core::scripting::native::{self};
+use eucalyptus_core::states::{Label, ModelProperties, Value};
+
+use dropbear_engine::entity::EntityTransform;
+use hecs::World;
+use std::ffi::{CString, c_char};
+use std::hint::black_box;
+use std::time::Instant;
+use winit::keyboard::KeyCode;
+
+const WORLD_SIZES: &[usize] = &[1_000, 10_000, 100_000];
+const BATCH: usize = 256;
+
+struct Gate {
+    scale: f64,
+    failures: Vec<String>,
+}
+
+impl Gate {
+    fn new() -> Self {
+        let scale = std::env::var("FFI_BENCH_SCALE")
+            .ok()
+            .and_then(|s| s.parse::<f64>().ok())
+            .unwrap_or(1.0);
+        Self {
+            scale,
+            failures: Vec::new(),
+        }
+    }
+
+    /// Times `f` and reports ns/call + calls/sec, recording a failure when the
+    /// measurement exceeds `max_ns * FFI_BENCH_SCALE`.
+    fn bench(&mut self, name: &str, iters: u64, max_ns: f64, mut f: impl FnMut()) {
+        // Warmup so lazy statics, caches and allocator pools are primed.
+        for _ in 0..iters.min(100) {
+            f();
+        }
+
+        let start = Instant::now();
+        for _ in 0..iters {
+            f();
+        }
+        let elapsed = start.elapsed();
+
+        let ns_per_call = elapsed.as_nanos() as f64 / iters as f64;
+        let calls_per_sec = 1e9 / ns_per_call;
+        let limit = max_ns * self.scale;
+        let verdict = if ns_per_call <= limit { "ok" } else { "FAIL" };
+
+        println!(
+            "{:<44} {:>12.1} ns/call {:>14.0} calls/s (limit {:>10.0} ns) {}",
+            name, ns_per_call, calls_per_sec, limit, verdict
+        );
+
+        if ns_per_call > limit {
+            self.failures.push(format!(
+                "{}: {:.1} ns/call exceeds limit of {:.0} ns",
+                name, ns_per_call, limit
+            ));
+        }
+    }
+}
+
+fn build_world(entity_count: usize) -> (World, Vec<i64>) {
+    let mut world = World::new();
+    let mut ids = Vec::with_capacity(entity_count);
+    for i in 0..entity_count {
+        let mut props = ModelProperties::default();
+        props.set_property("health".to_string(), Value::Int(100));
+        props.set_property("speed".to_string(), Value::Float(4.5));
+        let entity = world.spawn((
+            Label::from(format!("entity_{}", i)),
+            EntityTransform::default(),
+            props,
+        ));
+        ids.push(entity.id() as i64);
+    }
+    (world, ids)
+}
+
+fn main() {
+    let mut gate = Gate::new();
+
+    for &size in WORLD_SIZES {
+        let (world, ids) = build_world(size);
+        let world_ptr = &world as *const World;
+        let mid = ids[ids.len() / 2];
+
+        let label = CString::new(format!("entity_{}", size / 2)).unwrap();
+        let mut out_entity: i64 = 0;
+        gate.bench(
+            &format!("dropbear_get_entity ({}k world)", size / 1000),
+            100_000,
+            2_000.0,
+            || unsafe {
+                black_box(dropbear_get_entity(
+                    label.as_ptr(),
+                    world_ptr,
+                    &mut out_entity,
+                ));
+            },
+        );
+
+        let mut out_transform = NativeTransform::default();
+        gate.bench(
+            &format!("dropbear_get_world_transform ({}k world)", size / 1000),
+            100_000,
+            1_000.0,
+            || unsafe {
+                black_box(dropbear_get_world_transform(
+                    world_ptr,
+                    mid,
+                    &mut out_transform,
+                ));
+            },
+        );
+
+        let mut out_ptr: *const NativeTransform = std::ptr::null();
+        let mut out_ids: *const i64 = std::ptr::null();
+        let mut out_count: i64 = 0;
+        gate.bench(
+            &format!("dropbear_map_world_transforms rebuild ({}k)", size / 1000),
+            200,
+            (size as f64) * 200.0,
+            || unsafe {
+                native::begin_frame();
+                black_box(dropbear_map_world_transforms(
+                    world_ptr,
+                    &mut out_ptr,
+                    &mut out_ids,
+                    &mut out_count,
+                ));
+            },
+        );
+        gate.bench(
+            &format!("dropbear_map_world_transforms cached ({}k)", size / 1000),
+            100_000,
+            500.0,
+            || unsafe {
+                black_box(dropbear_map_world_transforms(
+                    world_ptr,
+                    &mut out_ptr,
+                    &mut out_ids,
+                    &mut out_count,
+                ));
+            },
+        );
+    }
+
+    // The remaining calls don't walk the whole world; a mid-sized one is representative.
+    let (mut world, ids) = build_world(10_000);
+    let world_ptr = &world as *const World;
+    let world_mut_ptr = &mut world as *mut World;
+
+    let labels: Vec<CString> = (0..BATCH)
+        .map(|i| CString::new(format!("entity_{}", i * 7)).unwrap())
+        .collect();
+    let label_ptrs: Vec<*const c_char> = labels.iter().map(|l| l.as_ptr()).collect();
+    let mut out_entities = vec![0i64; BATCH];
+    gate.bench(
+        &format!("dropbear_get_entities (batch of {})", BATCH),
+        10_000,
+        (BATCH as f64) * 300.0,
+        || unsafe {
+            black_box(dropbear_get_entities(
+                label_ptrs.as_ptr(),
+                world_ptr,
+                out_entities.as_mut_ptr(),
+                BATCH as i32,
+            ));
+        },
+    );
+
+    let batch_ids: Vec<i64> = ids.iter().step_by(ids.len() / BATCH).take(BATCH).copied().collect();
+    let mut transforms = vec![NativeEntityTransform::default(); BATCH];
+    gate.bench(
+        &format!("dropbear_get_transforms_batch ({})", BATCH),
+        10_000,
+        (BATCH as f64) * 300.0,
+        || unsafe {
+            black_box(dropbear_get_transforms_batch(
+                world_ptr,
+                batch_ids.as_ptr(),
+                transforms.as_mut_ptr(),
+                BATCH as i32,
+            ));
+        },
+    );
+    gate.bench(
+        &format!("dropbear_set_transforms_batch ({})", BATCH),
+        10_000,
+        (BATCH as f64) * 300.0,
+        || unsafe {
+            black_box(dropbear_set_transforms_batch(
+                world_ptr,
+                batch_ids.as_ptr(),
+                transforms.as_ptr(),
+                BATCH as i32,
+            ));
+        },
+    );
+
+    let cmd_transform = NativeEntityTransform::default();
+    gate.bench(
+        &format!("cmd begin/set_transform x{}/submit", BATCH),
+        5_000,
+        (BATCH as f64) * 500.0,
+        || unsafe {
+            dropbear_cmd_begin(world_mut_ptr);
+            for &id in &batch_ids {
+                dropbear_cmd_set_transform(id, &cmd_transform);
+            }
+            black_box(dropbear_cmd_submit());
+        },
+    );
+
+    // Property exports require a MeshRenderer, which needs a GPU; this measures the
+    // probe-and-miss path that scripts hit for optional properties.
+    let prop_label = CString::new("health").unwrap();
+    let mut out_int: i32 = 0;
+    gate.bench(
+        "dropbear_get_int_property (miss path)",
+        100_000,
+        500.0,
+        || unsafe {
+            black_box(dropbear_get_int_property(
+                world_ptr,
+                ids[42],
+                prop_label.as_ptr(),
+                &mut out_int,
+            ));
+        },
+    );
+
+    // Hit path for the property store itself, without the renderer query in front.
+    let mut props = ModelProperties::default();
+    props.set_property("health".to_string(), Value::Int(100));
+    gate.bench("ModelProperties::get_property (hit path)", 100_000, 300.0, || {
+        black_box(props.get_property("health"));
+    });
+
+    let mut input = InputState::default();
+    input.pressed_keys.insert(KeyCode::KeyW);
+    input.pressed_keys.insert(KeyCode::Space);
+    input.mouse_pos = (320.0, 240.0);
+    let input_ptr = &mut input as *mut InputState;
+
+    let mut snapshot = NativeInputSnapshot::default();
+    gate.bench("dropbear_get_input_snapshot", 100_000, 800.0, || unsafe {
+        black_box(dropbear_get_input_snapshot(input_ptr, &mut snapshot));
+    });
+
+    let mut out_pressed: i32 = 0;
+    gate.bench("dropbear_is_key_pressed", 100_000, 300.0, || unsafe {
+        black_box(dropbear_is_key_pressed(input_ptr, 26, &mut out_pressed));
+    });
+
+    let mut words = [0u64; 4];
+    gate.bench("dropbear_get_key_bitset", 100_000, 500.0, || unsafe {
+        black_box(dropbear_get_key_bitset(input_ptr, words.as_mut_ptr(), 4));
+    });
+
+    if gate.failures.is_empty() {
+        println!("\nall thresholds passed");
+    } else {
+        println!("\n{} threshold(s) exceeded:", gate.failures.len());
+        for failure in &gate.failures {
+            println!("  {}", failure);
+        }
+        std::process::exit(1);
+    }
+}
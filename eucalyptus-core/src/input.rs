@@ -1,12 +1,44 @@
 use dropbear_engine::gilrs::{Button, GamepadId};
 use std::sync::Arc;
+use std::sync::atomic::{AtomicU64, Ordering};
 use std::{
-    collections::{HashMap, HashSet},
+    collections::{HashMap, HashSet, VecDeque},
     time::{Duration, Instant},
 };
 use winit::window::Window;
 use winit::{event::MouseButton, keyboard::KeyCode};
 
+/// Edge event kinds, mirroring the `DROPBEAR_INPUT_EVENT_*` defines in dropbear.h.
+pub const INPUT_EVENT_KEY_DOWN: i32 = 0;
+pub const INPUT_EVENT_KEY_UP: i32 = 1;
+pub const INPUT_EVENT_MOUSE_DOWN: i32 = 2;
+pub const INPUT_EVENT_MOUSE_UP: i32 = 3;
+/// Reserved: wheel events are not routed through the input manager yet.
+pub const INPUT_EVENT_SCROLL: i32 = 4;
+
+/// Events older than this get dropped from the front; a script that stops draining
+/// should not grow the queue without bound.
+const EVENT_QUEUE_CAP: usize = 512;
+
+/// Frame stamp applied to queued events; advanced once per script tick by
+/// `scripting::native::begin_frame`.
+static FRAME_STAMP: AtomicU64 = AtomicU64::new(0);
+
+pub fn advance_frame() {
+    FRAME_STAMP.fetch_add(1, Ordering::Relaxed);
+}
+
+/// One edge-triggered input transition, stamped with the script frame it arrived on.
+/// `code` is a keycode ordinal (see [`crate::utils::ordinal_from_keycode`]) for key
+/// events, or a mouse button index (0 = left, 1 = right, 2 = middle, 3 = back,
+/// 4 = forward, 5+ = other) for button events.
+#[derive(Clone, Copy, Debug)]
+pub struct InputEvent {
+    pub kind: i32,
+    pub code: i32,
+    pub frame: u64,
+}
+
 #[derive(Clone, Debug)]
 pub struct InputState {
     pub window: Option<Arc<Window>>,
@@ -30,6 +62,10 @@ pub struct InputState {
     pub pressed_buttons: HashMap<GamepadId, HashSet<Button>>,
     pub left_stick_position: HashMap<GamepadId, (f32, f32)>,
     pub right_stick_position: HashMap<GamepadId, (f32, f32)>,
+
+    /// Edge-triggered event queue drained by `dropbear_drain_input_events`; undrained
+    /// events persist across frames up to [`EVENT_QUEUE_CAP`], oldest dropped first.
+    pub event_queue: VecDeque<InputEvent>,
 }
 
 impl Default for InputState {
@@ -55,9 +91,53 @@ impl InputState {
             pressed_buttons: Default::default(),
             left_stick_position: Default::default(),
             right_stick_position: Default::default(),
+            event_queue: VecDeque::new(),
         }
     }
 
+    fn push_event(&mut self, kind: i32, code: i32) {
+        if self.event_queue.len() >= EVENT_QUEUE_CAP {
+            self.event_queue.pop_front();
+        }
+        self.event_queue.push_back(InputEvent {
+            kind,
+            code,
+            frame: FRAME_STAMP.load(std::sync::atomic::Ordering::Relaxed),
+        });
+    }
+
+    /// Records a key edge; call from the `Keyboard` handler so only real transitions
+    /// (not key repeat) land in the queue.
+    pub fn push_key_event(&mut self, key: KeyCode, pressed: bool) {
+        if let Some(ordinal) = crate::utils::ordinal_from_keycode(key) {
+            let kind = if pressed {
+                INPUT_EVENT_KEY_DOWN
+            } else {
+                INPUT_EVENT_KEY_UP
+            };
+            self.push_event(kind, ordinal);
+        }
+    }
+
+    /// Records a mouse button edge, using the same button indices as the snapshot's
+    /// `mouse_button_mask`.
+    pub fn push_mouse_button_event(&mut self, button: MouseButton, pressed: bool) {
+        let code = match button {
+            MouseButton::Left => 0,
+            MouseButton::Right => 1,
+            MouseButton::Middle => 2,
+            MouseButton::Back => 3,
+            MouseButton::Forward => 4,
+            MouseButton::Other(n) => 5 + n as i32,
+        };
+        let kind = if pressed {
+            INPUT_EVENT_MOUSE_DOWN
+        } else {
+            INPUT_EVENT_MOUSE_UP
+        };
+        self.push_event(kind, code);
+    }
+
     pub fn lock_cursor(&mut self, toggle: bool) {
         self.is_cursor_locked = toggle;
     }
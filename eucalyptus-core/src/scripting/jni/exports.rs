@@ -667,6 +667,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getStringProperty(
             return std::ptr::null_mut();
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::String(val) => match env.new_string(val) {
@@ -737,6 +738,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getIntProperty(
             return 650911;
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::Int(val) => *val as jint,
@@ -798,6 +800,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getLongProperty(
             return 0;
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::Int(val) => *val as jlong,
@@ -856,6 +859,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getFloatProperty(
             return f64::NAN;
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::Float(val) => *val as jdouble,
@@ -914,6 +918,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getBoolProperty(
             return 0;
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::Bool(val) => {
@@ -978,6 +983,7 @@ pub fn Java_com_dropbear_ffi_JNINative_getVec3Property(
             return std::ptr::null_mut();
         };
         let output = props.get_property(&value);
+        let output = output.as_ref();
         if let Some(output) = output {
             match output {
                 Value::Vec3([x, y, z]) => {
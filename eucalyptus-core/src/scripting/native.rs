@@ -1,15 +1,28 @@
 //! Deals with Kotlin/Native library loading for different platforms.
 #![allow(clippy::missing_safety_doc)]
 
+pub mod api;
+pub mod arena;
+pub mod cmd;
 pub mod exports;
+pub mod label_index;
+pub mod last_error;
+pub mod lease;
+pub mod pak;
+pub mod prefab;
+pub mod profiling;
+pub mod script_log;
 pub mod sig;
+pub mod snapshot;
+pub mod transform_queue;
 pub mod types;
 
 use crate::ptr::{AssetRegistryPtr, GraphicsPtr, InputStatePtr, WorldPtr};
 use crate::scripting::error::LastErrorMessage;
 use crate::scripting::native::sig::{
-    DestroyAll, DestroyTagged, Init, LoadTagged, UpdateAll, UpdateTagged,
+    DestroyAll, DestroyTagged, Init, LoadTagged, SystemCount, SystemInfo, UpdateAll, UpdateTagged,
 };
+use crate::scripting::native::types::NativeSystemInfo;
 use libloading::{Library, Symbol};
 use std::ffi::CString;
 use std::path::Path;
@@ -25,6 +38,12 @@ pub struct NativeLibrary {
     destroy_all_fn: Symbol<'static, DestroyAll>,
     destroy_tagged_fn: Symbol<'static, DestroyTagged>,
 
+    // optional per-system metadata; libraries without it fall back to serial update_all
+    system_count_fn: Option<Symbol<'static, SystemCount>>,
+    system_info_fn: Option<Symbol<'static, SystemInfo>>,
+    /// Batches of system tags safe to tick concurrently, rebuilt on [`Self::load_systems`].
+    schedule: Option<Vec<Vec<String>>>,
+
     // err msg
     #[allow(dead_code)]
     pub(crate) get_last_err_msg_fn: Symbol<'static, sig::GetLastErrorMessage>,
@@ -62,6 +81,15 @@ impl NativeLibrary {
                         .get::<sig::SetLastErrorMessage>(b"dropbear_set_last_error_message\0")?,
                 );
 
+            let system_count_fn: Option<Symbol<'static, SystemCount>> = library
+                .get::<SystemCount>(b"dropbear_system_count\0")
+                .ok()
+                .map(|symbol| std::mem::transmute(symbol));
+            let system_info_fn: Option<Symbol<'static, SystemInfo>> = library
+                .get::<SystemInfo>(b"dropbear_system_info\0")
+                .ok()
+                .map(|symbol| std::mem::transmute(symbol));
+
             Ok(Self {
                 library,
                 init_fn,
@@ -70,6 +98,9 @@ impl NativeLibrary {
                 update_tag_fn,
                 destroy_all_fn,
                 destroy_tagged_fn,
+                system_count_fn,
+                system_info_fn,
+                schedule: None,
                 get_last_err_msg_fn,
                 set_last_err_msg_fn,
             })
@@ -100,11 +131,119 @@ impl NativeLibrary {
             if result != 0 {
                 anyhow::bail!("Load systems failed with code: {}", result);
             }
-            Ok(())
         }
+        self.rebuild_schedule();
+        Ok(())
+    }
+
+    /// Rebuilds the concurrent-dispatch schedule from the library's optional
+    /// `dropbear_system_count`/`dropbear_system_info` exports.
+    ///
+    /// Systems are greedily packed into batches where no system's writes overlap
+    /// another's reads or writes; any missing or malformed metadata clears the schedule
+    /// and [`Self::update_all`] falls back to the library's own serial tick.
+    fn rebuild_schedule(&mut self) {
+        self.schedule = None;
+        let (Some(count_fn), Some(info_fn)) = (&self.system_count_fn, &self.system_info_fn)
+        else {
+            return;
+        };
+
+        let mut batches: Vec<(Vec<String>, u64, u64)> = Vec::new();
+        unsafe {
+            let count = (count_fn)();
+            if count <= 0 {
+                return;
+            }
+
+            for index in 0..count {
+                let mut info = NativeSystemInfo {
+                    tag: std::ptr::null(),
+                    reads: 0,
+                    writes: 0,
+                };
+                if (info_fn)(index, &mut info) != 0 || info.tag.is_null() {
+                    log::warn!(
+                        "dropbear_system_info failed for system {}, disabling parallel dispatch",
+                        index
+                    );
+                    return;
+                }
+                let Ok(tag) = std::ffi::CStr::from_ptr(info.tag).to_str() else {
+                    log::warn!(
+                        "System {} has a non-UTF-8 tag, disabling parallel dispatch",
+                        index
+                    );
+                    return;
+                };
+
+                // A system may only join a batch that runs after every earlier-declared
+                // system it conflicts with — packing it into an earlier batch would run
+                // it ahead of a write it reads. So place it right after the last
+                // conflicting batch (that batch cannot conflict, or it would be the
+                // last), opening a new one when the conflict is in the final batch.
+                let conflicts = |batch_reads: u64, batch_writes: u64| {
+                    (info.writes & (batch_reads | batch_writes)) != 0
+                        || (batch_writes & info.reads) != 0
+                };
+                let target = batches
+                    .iter()
+                    .rposition(|(_, batch_reads, batch_writes)| {
+                        conflicts(*batch_reads, *batch_writes)
+                    })
+                    .map_or(0, |last_conflict| last_conflict + 1);
+                if let Some(batch) = batches.get_mut(target) {
+                    batch.0.push(tag.to_string());
+                    batch.1 |= info.reads;
+                    batch.2 |= info.writes;
+                } else {
+                    batches.push((vec![tag.to_string()], info.reads, info.writes));
+                }
+            }
+        }
+
+        log::debug!(
+            "Script schedule: {} systems in {} batches",
+            batches.iter().map(|b| b.0.len()).sum::<usize>(),
+            batches.len()
+        );
+        self.schedule = Some(batches.into_iter().map(|batch| batch.0).collect());
     }
 
     pub fn update_all(&mut self, dt: f32) -> anyhow::Result<()> {
+        begin_frame();
+
+        // With declared dependencies, tick each batch of non-conflicting systems
+        // concurrently through update_tagged; the batches run in declared order, so
+        // conflicting systems still observe each other's writes like a serial tick.
+        if let Some(batches) = &self.schedule {
+            let update_tagged: UpdateTagged = *self.update_tag_fn;
+            for batch in batches {
+                match batch.as_slice() {
+                    [tag] => {
+                        let c_string = CString::new(tag.clone())?;
+                        unsafe {
+                            update_tagged(c_string.as_ptr(), dt);
+                        }
+                    }
+                    tags => {
+                        rayon::scope(|scope| {
+                            for tag in tags {
+                                scope.spawn(move |_| {
+                                    if let Ok(c_string) = CString::new(tag.clone()) {
+                                        unsafe {
+                                            update_tagged(c_string.as_ptr(), dt);
+                                        }
+                                    }
+                                });
+                            }
+                        });
+                    }
+                }
+            }
+            return Ok(());
+        }
+
         unsafe {
             (self.update_all_fn)(dt);
             Ok(())
@@ -158,6 +297,39 @@ impl LastErrorMessage for NativeLibrary {
     }
 }
 
+/// Per-frame upkeep for the engine-owned buffers the native bridge hands out to scripts.
+///
+/// Runs at the top of every script tick (see [`NativeLibrary::update_all`]); anything whose
+/// lifetime is documented as "valid until the next `update_all`" gets reset here.
+pub fn begin_frame() {
+    crate::input::advance_frame();
+    snapshot::invalidate();
+    arena::reset();
+    lease::reset();
+    // Discard last frame's undrained geometry batches; queued geometry is frame-scoped.
+    drop(crate::window::drain_geometry());
+}
+
+/// Recovers an [`hecs::Entity`] from a script-side `int64_t` handle and confirms it is
+/// still alive, in O(1).
+///
+/// Handles minted by this API carry hecs' full `to_bits` encoding — slot index in the
+/// low 32 bits, generation in the high 32 — so a handle held across a despawn stops
+/// resolving instead of silently aliasing whatever entity reuses the slot. A handle
+/// whose generation half is zero predates the encoding (or was built script-side from
+/// a bare index) and falls back to the index-only lookup, still gated on liveness.
+pub(crate) fn entity_from_handle(world: &hecs::World, handle: i64) -> Option<hecs::Entity> {
+    let bits = handle as u64;
+    if bits >> 32 == 0 {
+        let entity = unsafe { world.find_entity_from_id(bits as u32) };
+        return world.contains(entity).then_some(entity);
+    }
+    match hecs::Entity::from_bits(bits) {
+        Some(entity) if world.contains(entity) => Some(entity),
+        _ => None,
+    }
+}
+
 /// Displays the types of errors that can be returned by the native library.
 pub enum DropbearNativeError {
     /// An error in the case the function returns an unsigned value.
@@ -174,6 +346,9 @@ pub enum DropbearNativeError {
     WorldInsertError = -6,
     /// When the graphics queue fails to send its message to the receiver
     SendError = -7,
+    /// When a mutating call is refused because worker threads hold a read lease over the
+    /// world (see `dropbear_world_acquire_read`)
+    ReadLeaseHeld = -8,
 
     InvalidUTF8 = -108,
     /// A generic error when the library doesn't know what happened or cannot find a
@@ -0,0 +1,249 @@
+//! The single-lookup dispatch table handed to scripts.
+//!
+//! Instead of resolving every `dropbear_*` export with its own dynamic symbol lookup, a
+//! script host resolves only `dropbear_get_api` and receives this table of function
+//! pointers plus an ABI version check, so a header/dylib mismatch becomes a clean error at
+//! startup instead of a crash mid-frame. The struct layout is mirrored in dropbear.h;
+//! ALWAYS append new exports at the end and bump [`DROPBEAR_API_VERSION`] when the table
+//! changes.
+
+use crate::ptr::{AssetRegistryPtr, GraphicsPtr, InputStatePtr};
+use crate::scripting::native::exports;
+use crate::scripting::native::types::{
+    NativeCamera, NativeEntityTransform, NativeInputEvent, NativeInputSnapshot, NativeTransform,
+    Vector3D,
+};
+use hecs::World;
+use std::ffi::c_char;
+
+/// Bumped whenever the layout of [`DropbearApi`] changes.
+pub const DROPBEAR_API_VERSION: u32 = 10;
+
+#[repr(C)]
+pub struct DropbearApi {
+    pub version: u32,
+    pub dropbear_get_entity: unsafe extern "C" fn(*const c_char, *const World, *mut i64) -> i32,
+    pub dropbear_get_entities: unsafe extern "C" fn(*const *const c_char, *const World, *mut i64, i32) -> i32,
+    pub dropbear_get_world_transform: unsafe extern "C" fn(*const World, i64, *mut NativeTransform) -> i32,
+    pub dropbear_get_local_transform: unsafe extern "C" fn(*const World, i64, *mut NativeTransform) -> i32,
+    pub dropbear_get_transforms_batch: unsafe extern "C" fn(*const World, *const i64, *mut NativeEntityTransform, i32) -> i32,
+    pub dropbear_set_transforms_batch: unsafe extern "C" fn(*const World, *const i64, *const NativeEntityTransform, i32) -> i32,
+    pub dropbear_map_world_transforms: unsafe extern "C" fn(*const World, *mut *const NativeTransform, *mut *const i64, *mut i64) -> i32,
+    pub dropbear_get_string_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut c_char, i32) -> i32,
+    pub dropbear_get_string_property_view: unsafe extern "C" fn(*const World, i64, *const c_char, *mut *const c_char, *mut i32) -> i32,
+    pub dropbear_get_int_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut i32) -> i32,
+    pub dropbear_get_long_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut i64) -> i32,
+    pub dropbear_get_float_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut f32) -> i32,
+    pub dropbear_get_double_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut f64) -> i32,
+    pub dropbear_get_bool_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut i32) -> i32,
+    pub dropbear_get_vec3_property: unsafe extern "C" fn(*const World, i64, *const c_char, *mut f32, *mut f32, *mut f32) -> i32,
+    pub dropbear_set_string_property: unsafe extern "C" fn(*const World, i64, *const c_char, *const c_char) -> i32,
+    pub dropbear_set_int_property: unsafe extern "C" fn(*const World, i64, *const c_char, i32) -> i32,
+    pub dropbear_set_long_property: unsafe extern "C" fn(*const World, i64, *const c_char, i64) -> i32,
+    pub dropbear_set_float_property: unsafe extern "C" fn(*const World, i64, *const c_char, f32) -> i32,
+    pub dropbear_set_double_property: unsafe extern "C" fn(*const World, i64, *const c_char, f64) -> i32,
+    pub dropbear_set_bool_property: unsafe extern "C" fn(*const World, i64, *const c_char, i32) -> i32,
+    pub dropbear_set_vec3_property: unsafe extern "C" fn(*const World, i64, *const c_char, f32, f32, f32) -> i32,
+    pub dropbear_query_entities: unsafe extern "C" fn(*const World, u32, *mut i64, i32, *mut i32) -> i32,
+    pub dropbear_get_float_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut f32, i32) -> i32,
+    pub dropbear_get_int_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut i32, i32) -> i32,
+    pub dropbear_get_long_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut i64, i32) -> i32,
+    pub dropbear_get_double_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut f64, i32) -> i32,
+    pub dropbear_get_bool_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut i32, i32) -> i32,
+    pub dropbear_get_vec3_property_batch: unsafe extern "C" fn(*const World, *const i64, *const c_char, *mut Vector3D, i32) -> i32,
+    pub dropbear_world_acquire_read: unsafe extern "C" fn(*const World, *mut u64) -> i32,
+    pub dropbear_world_release_read: unsafe extern "C" fn(u64) -> i32,
+    pub dropbear_prefab_resolve: unsafe extern "C" fn(*const c_char, *mut u64) -> i32,
+    pub dropbear_spawn_batch: unsafe extern "C" fn(*const World, u64, *const NativeTransform, i32, *mut i64) -> i32,
+    pub dropbear_despawn_batch: unsafe extern "C" fn(*const World, *const i64, i32) -> i32,
+    pub dropbear_cmd_begin: unsafe extern "C" fn(*const World) -> i32,
+    pub dropbear_cmd_set_transform: unsafe extern "C" fn(i64, *const NativeEntityTransform) -> i32,
+    pub dropbear_cmd_set_string_property: unsafe extern "C" fn(i64, *const c_char, *const c_char) -> i32,
+    pub dropbear_cmd_set_int_property: unsafe extern "C" fn(i64, *const c_char, i32) -> i32,
+    pub dropbear_cmd_set_long_property: unsafe extern "C" fn(i64, *const c_char, i64) -> i32,
+    pub dropbear_cmd_set_float_property: unsafe extern "C" fn(i64, *const c_char, f32) -> i32,
+    pub dropbear_cmd_set_double_property: unsafe extern "C" fn(i64, *const c_char, f64) -> i32,
+    pub dropbear_cmd_set_bool_property: unsafe extern "C" fn(i64, *const c_char, i32) -> i32,
+    pub dropbear_cmd_set_vec3_property: unsafe extern "C" fn(i64, *const c_char, f32, f32, f32) -> i32,
+    pub dropbear_cmd_submit: unsafe extern "C" fn() -> i32,
+    pub dropbear_resolve_property_id: unsafe extern "C" fn(*const World, i64, *const c_char, *mut i32) -> i32,
+    pub dropbear_get_string_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut c_char, i32) -> i32,
+    pub dropbear_get_int_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut i32) -> i32,
+    pub dropbear_get_long_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut i64) -> i32,
+    pub dropbear_get_float_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut f32) -> i32,
+    pub dropbear_get_double_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut f64) -> i32,
+    pub dropbear_get_bool_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut i32) -> i32,
+    pub dropbear_get_vec3_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *mut f32, *mut f32, *mut f32) -> i32,
+    pub dropbear_set_string_property_by_id: unsafe extern "C" fn(*const World, i64, i32, *const c_char) -> i32,
+    pub dropbear_set_int_property_by_id: unsafe extern "C" fn(*const World, i64, i32, i32) -> i32,
+    pub dropbear_set_long_property_by_id: unsafe extern "C" fn(*const World, i64, i32, i64) -> i32,
+    pub dropbear_set_float_property_by_id: unsafe extern "C" fn(*const World, i64, i32, f32) -> i32,
+    pub dropbear_set_double_property_by_id: unsafe extern "C" fn(*const World, i64, i32, f64) -> i32,
+    pub dropbear_set_bool_property_by_id: unsafe extern "C" fn(*const World, i64, i32, i32) -> i32,
+    pub dropbear_set_vec3_property_by_id: unsafe extern "C" fn(*const World, i64, i32, f32, f32, f32) -> i32,
+    pub dropbear_print_input_state: unsafe extern "C" fn(InputStatePtr),
+    pub dropbear_get_input_snapshot: unsafe extern "C" fn(InputStatePtr, *mut NativeInputSnapshot) -> i32,
+    pub dropbear_get_key_bitset: unsafe extern "C" fn(InputStatePtr, *mut u64, i32) -> i32,
+    pub dropbear_is_key_pressed: unsafe extern "C" fn(InputStatePtr, i32, *mut i32) -> i32,
+    pub dropbear_get_mouse_position: unsafe extern "C" fn(InputStatePtr, *mut f32, *mut f32) -> i32,
+    pub dropbear_is_mouse_button_pressed: unsafe extern "C" fn(InputStatePtr, i32, *mut i32) -> i32,
+    pub dropbear_get_mouse_delta: unsafe extern "C" fn(InputStatePtr, *mut f32, *mut f32) -> i32,
+    pub dropbear_is_cursor_locked: unsafe extern "C" fn(InputStatePtr, *mut i32) -> i32,
+    pub dropbear_set_cursor_locked: unsafe extern "C" fn(GraphicsPtr, InputStatePtr, i32) -> i32,
+    pub dropbear_get_camera: unsafe extern "C" fn(*const World, *const c_char, *mut NativeCamera) -> i32,
+    pub dropbear_get_attached_camera: unsafe extern "C" fn(*const World, i64, *mut NativeCamera) -> i32,
+    pub dropbear_set_camera: unsafe extern "C" fn(*mut World, *const NativeCamera) -> i32,
+    pub dropbear_get_camera_matrices: unsafe extern "C" fn(*const World, i64, *mut f32, *mut f32, *mut f32) -> i32,
+    pub dropbear_world_to_screen: unsafe extern "C" fn(*const World, i64, *const Vector3D, *mut f32, i32) -> i32,
+    pub dropbear_set_camera_fields: unsafe extern "C" fn(*mut World, i64, u32, *const NativeCamera) -> i32,
+    pub dropbear_get_last_mouse_pos: unsafe extern "C" fn(InputStatePtr, *mut f32, *mut f32) -> i32,
+    pub dropbear_is_cursor_hidden: unsafe extern "C" fn(InputStatePtr, *mut i32) -> i32,
+    pub dropbear_set_cursor_hidden: unsafe extern "C" fn(GraphicsPtr, InputStatePtr, i32) -> i32,
+    pub dropbear_get_last_error: unsafe extern "C" fn(*mut c_char, i32) -> i32,
+    pub dropbear_set_error_verbosity: unsafe extern "C" fn(i32) -> i32,
+    pub dropbear_asset_load_async: unsafe extern "C" fn(AssetRegistryPtr, *const c_char, *mut u64) -> i32,
+    pub dropbear_future_status: unsafe extern "C" fn(AssetRegistryPtr, u64, *mut i32) -> i32,
+    pub dropbear_future_exchange: unsafe extern "C" fn(AssetRegistryPtr, u64, *mut u8, i64, *mut i64) -> i32,
+    pub dropbear_frame_arena_alloc: unsafe extern "C" fn(i64) -> *mut u8,
+    pub dropbear_profiling_enable: unsafe extern "C" fn(i32) -> i32,
+    pub dropbear_profiling_snapshot: unsafe extern "C" fn(*mut crate::scripting::native::profiling::FfiStats, i32) -> i32,
+    pub dropbear_set_local_transform_deferred: unsafe extern "C" fn(*const World, i64, *const NativeTransform) -> i32,
+    pub dropbear_flush_transform_hierarchy: unsafe extern "C" fn(*const World) -> i32,
+    pub dropbear_drain_input_events: unsafe extern "C" fn(InputStatePtr, *mut NativeInputEvent, i32, *mut i32) -> i32,
+    pub dropbear_pak_get_bytes: unsafe extern "C" fn(AssetRegistryPtr, *const c_char, *mut *const u8, *mut u64) -> i32,
+    pub dropbear_queue_debug_lines: unsafe extern "C" fn(GraphicsPtr, *const Vector3D, *const u32, i32) -> i32,
+    pub dropbear_queue_dynamic_mesh: unsafe extern "C" fn(GraphicsPtr, *const f32, i32, *const u32, i32, u64) -> i32,
+    pub dropbear_entity_alive: unsafe extern "C" fn(*const World, i64, *mut i32) -> i32,
+    pub dropbear_job_submit: unsafe extern "C" fn(AssetRegistryPtr, Option<unsafe extern "C" fn(*mut std::ffi::c_void)>, *mut std::ffi::c_void, *mut u64) -> i32,
+    pub dropbear_job_status: unsafe extern "C" fn(AssetRegistryPtr, u64, *mut i32) -> i32,
+    pub dropbear_job_join: unsafe extern "C" fn(AssetRegistryPtr, u64) -> i32,
+    pub dropbear_job_cancel: unsafe extern "C" fn(AssetRegistryPtr, u64) -> i32,
+    pub dropbear_log: unsafe extern "C" fn(i32, *const c_char, *const c_char) -> i32,
+    pub dropbear_log_set_level: unsafe extern "C" fn(i32) -> i32,
+}
+
+/// The populated table. Function items coerce to the table's fn-pointer fields, so a
+/// missing or mismatched export is a compile error rather than a runtime surprise.
+pub const API: DropbearApi = DropbearApi {
+    version: DROPBEAR_API_VERSION,
+    dropbear_get_entity: exports::dropbear_get_entity,
+    dropbear_get_entities: exports::dropbear_get_entities,
+    dropbear_get_world_transform: exports::dropbear_get_world_transform,
+    dropbear_get_local_transform: exports::dropbear_get_local_transform,
+    dropbear_get_transforms_batch: exports::dropbear_get_transforms_batch,
+    dropbear_set_transforms_batch: exports::dropbear_set_transforms_batch,
+    dropbear_map_world_transforms: exports::dropbear_map_world_transforms,
+    dropbear_get_string_property: exports::dropbear_get_string_property,
+    dropbear_get_string_property_view: exports::dropbear_get_string_property_view,
+    dropbear_get_int_property: exports::dropbear_get_int_property,
+    dropbear_get_long_property: exports::dropbear_get_long_property,
+    dropbear_get_float_property: exports::dropbear_get_float_property,
+    dropbear_get_double_property: exports::dropbear_get_double_property,
+    dropbear_get_bool_property: exports::dropbear_get_bool_property,
+    dropbear_get_vec3_property: exports::dropbear_get_vec3_property,
+    dropbear_set_string_property: exports::dropbear_set_string_property,
+    dropbear_set_int_property: exports::dropbear_set_int_property,
+    dropbear_set_long_property: exports::dropbear_set_long_property,
+    dropbear_set_float_property: exports::dropbear_set_float_property,
+    dropbear_set_double_property: exports::dropbear_set_double_property,
+    dropbear_set_bool_property: exports::dropbear_set_bool_property,
+    dropbear_set_vec3_property: exports::dropbear_set_vec3_property,
+    dropbear_query_entities: exports::dropbear_query_entities,
+    dropbear_get_float_property_batch: exports::dropbear_get_float_property_batch,
+    dropbear_get_int_property_batch: exports::dropbear_get_int_property_batch,
+    dropbear_get_long_property_batch: exports::dropbear_get_long_property_batch,
+    dropbear_get_double_property_batch: exports::dropbear_get_double_property_batch,
+    dropbear_get_bool_property_batch: exports::dropbear_get_bool_property_batch,
+    dropbear_get_vec3_property_batch: exports::dropbear_get_vec3_property_batch,
+    dropbear_world_acquire_read: exports::dropbear_world_acquire_read,
+    dropbear_world_release_read: exports::dropbear_world_release_read,
+    dropbear_prefab_resolve: exports::dropbear_prefab_resolve,
+    dropbear_spawn_batch: exports::dropbear_spawn_batch,
+    dropbear_despawn_batch: exports::dropbear_despawn_batch,
+    dropbear_cmd_begin: exports::dropbear_cmd_begin,
+    dropbear_cmd_set_transform: exports::dropbear_cmd_set_transform,
+    dropbear_cmd_set_string_property: exports::dropbear_cmd_set_string_property,
+    dropbear_cmd_set_int_property: exports::dropbear_cmd_set_int_property,
+    dropbear_cmd_set_long_property: exports::dropbear_cmd_set_long_property,
+    dropbear_cmd_set_float_property: exports::dropbear_cmd_set_float_property,
+    dropbear_cmd_set_double_property: exports::dropbear_cmd_set_double_property,
+    dropbear_cmd_set_bool_property: exports::dropbear_cmd_set_bool_property,
+    dropbear_cmd_set_vec3_property: exports::dropbear_cmd_set_vec3_property,
+    dropbear_cmd_submit: exports::dropbear_cmd_submit,
+    dropbear_resolve_property_id: exports::dropbear_resolve_property_id,
+    dropbear_get_string_property_by_id: exports::dropbear_get_string_property_by_id,
+    dropbear_get_int_property_by_id: exports::dropbear_get_int_property_by_id,
+    dropbear_get_long_property_by_id: exports::dropbear_get_long_property_by_id,
+    dropbear_get_float_property_by_id: exports::dropbear_get_float_property_by_id,
+    dropbear_get_double_property_by_id: exports::dropbear_get_double_property_by_id,
+    dropbear_get_bool_property_by_id: exports::dropbear_get_bool_property_by_id,
+    dropbear_get_vec3_property_by_id: exports::dropbear_get_vec3_property_by_id,
+    dropbear_set_string_property_by_id: exports::dropbear_set_string_property_by_id,
+    dropbear_set_int_property_by_id: exports::dropbear_set_int_property_by_id,
+    dropbear_set_long_property_by_id: exports::dropbear_set_long_property_by_id,
+    dropbear_set_float_property_by_id: exports::dropbear_set_float_property_by_id,
+    dropbear_set_double_property_by_id: exports::dropbear_set_double_property_by_id,
+    dropbear_set_bool_property_by_id: exports::dropbear_set_bool_property_by_id,
+    dropbear_set_vec3_property_by_id: exports::dropbear_set_vec3_property_by_id,
+    dropbear_print_input_state: exports::dropbear_print_input_state,
+    dropbear_get_input_snapshot: exports::dropbear_get_input_snapshot,
+    dropbear_get_key_bitset: exports::dropbear_get_key_bitset,
+    dropbear_is_key_pressed: exports::dropbear_is_key_pressed,
+    dropbear_get_mouse_position: exports::dropbear_get_mouse_position,
+    dropbear_is_mouse_button_pressed: exports::dropbear_is_mouse_button_pressed,
+    dropbear_get_mouse_delta: exports::dropbear_get_mouse_delta,
+    dropbear_is_cursor_locked: exports::dropbear_is_cursor_locked,
+    dropbear_set_cursor_locked: exports::dropbear_set_cursor_locked,
+    dropbear_get_camera: exports::dropbear_get_camera,
+    dropbear_get_attached_camera: exports::dropbear_get_attached_camera,
+    dropbear_set_camera: exports::dropbear_set_camera,
+    dropbear_get_camera_matrices: exports::dropbear_get_camera_matrices,
+    dropbear_world_to_screen: exports::dropbear_world_to_screen,
+    dropbear_set_camera_fields: exports::dropbear_set_camera_fields,
+    dropbear_get_last_mouse_pos: exports::dropbear_get_last_mouse_pos,
+    dropbear_is_cursor_hidden: exports::dropbear_is_cursor_hidden,
+    dropbear_set_cursor_hidden: exports::dropbear_set_cursor_hidden,
+    dropbear_get_last_error: exports::dropbear_get_last_error,
+    dropbear_set_error_verbosity: exports::dropbear_set_error_verbosity,
+    dropbear_asset_load_async: exports::dropbear_asset_load_async,
+    dropbear_future_status: exports::dropbear_future_status,
+    dropbear_future_exchange: exports::dropbear_future_exchange,
+    dropbear_frame_arena_alloc: exports::dropbear_frame_arena_alloc,
+    dropbear_profiling_enable: exports::dropbear_profiling_enable,
+    dropbear_profiling_snapshot: exports::dropbear_profiling_snapshot,
+    dropbear_set_local_transform_deferred: exports::dropbear_set_local_transform_deferred,
+    dropbear_flush_transform_hierarchy: exports::dropbear_flush_transform_hierarchy,
+    dropbear_drain_input_events: exports::dropbear_drain_input_events,
+    dropbear_pak_get_bytes: exports::dropbear_pak_get_bytes,
+    dropbear_queue_debug_lines: exports::dropbear_queue_debug_lines,
+    dropbear_queue_dynamic_mesh: exports::dropbear_queue_dynamic_mesh,
+    dropbear_entity_alive: exports::dropbear_entity_alive,
+    dropbear_job_submit: exports::dropbear_job_submit,
+    dropbear_job_status: exports::dropbear_job_status,
+    dropbear_job_join: exports::dropbear_job_join,
+    dropbear_job_cancel: exports::dropbear_job_cancel,
+    dropbear_log: exports::dropbear_log,
+    dropbear_log_set_level: exports::dropbear_log_set_level,
+};
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_api(requested_version: u32, out_api: *mut DropbearApi) -> i32 {
+    use crate::scripting::native::DropbearNativeError;
+
+    if out_api.is_null() {
+        crate::record_error!("[dropbear_get_api] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    if requested_version != DROPBEAR_API_VERSION {
+        crate::record_error!(
+            "[dropbear_get_api] [ERROR] ABI mismatch: host requested version {}, engine is {}",
+            requested_version,
+            DROPBEAR_API_VERSION
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    }
+
+    unsafe { std::ptr::write(out_api, API) };
+    DropbearNativeError::Success as i32
+}
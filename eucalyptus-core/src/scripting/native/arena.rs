@@ -0,0 +1,91 @@
+//! Per-frame bump arena for transient FFI allocations.
+//!
+//! Everything the bridge hands out with a "valid until the next tick" lifetime lives here:
+//! script-requested scratch buffers (`dropbear_frame_arena_alloc`) and the frame-pinned
+//! strings behind the zero-copy property views. Allocation is a bump within a chunk, so
+//! there are no per-call frees and no allocator contention with the renderer; the whole
+//! arena is rewound in one move at the top of the next script tick
+//! (see [`begin_frame`](super::begin_frame)), keeping its chunks for reuse.
+//!
+//! Chunks are never moved or shrunk while in use, so handed-out pointers stay stable for
+//! the rest of the frame even as more allocations land.
+
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+use std::ffi::c_char;
+
+const CHUNK_SIZE: usize = 64 * 1024;
+const ALIGN: usize = 16;
+
+struct Arena {
+    chunks: Vec<Box<[u8]>>,
+    /// Index of the chunk currently being bumped.
+    chunk_index: usize,
+    /// Bump offset within that chunk.
+    offset: usize,
+}
+
+static ARENA: Lazy<Mutex<Arena>> = Lazy::new(|| {
+    Mutex::new(Arena {
+        chunks: Vec::new(),
+        chunk_index: 0,
+        offset: 0,
+    })
+});
+
+impl Arena {
+    fn alloc(&mut self, size: usize) -> *mut u8 {
+        let size = size.max(1).next_multiple_of(ALIGN);
+
+        let needs_new_chunk = match self.chunks.get(self.chunk_index) {
+            Some(chunk) => self.offset + size > chunk.len(),
+            None => true,
+        };
+
+        if needs_new_chunk {
+            if !self.chunks.is_empty() {
+                self.chunk_index += 1;
+            }
+            // Reuse a chunk left over from an earlier frame when it is big enough,
+            // otherwise splice in a fresh one (oversize requests get a dedicated chunk).
+            let reusable = self
+                .chunks
+                .get(self.chunk_index)
+                .is_some_and(|chunk| chunk.len() >= size);
+            if !reusable {
+                let chunk = vec![0u8; size.max(CHUNK_SIZE)].into_boxed_slice();
+                self.chunks.insert(self.chunk_index, chunk);
+            }
+            self.offset = 0;
+        }
+
+        let ptr = self.chunks[self.chunk_index].as_mut_ptr();
+        let ptr = unsafe { ptr.add(self.offset) };
+        self.offset += size;
+        ptr
+    }
+}
+
+/// Bump-allocates `size` bytes valid until the next script tick.
+pub fn alloc(size: usize) -> *mut u8 {
+    ARENA.lock().alloc(size)
+}
+
+/// Pins `s` in the arena for the rest of the frame, returning a NUL-terminated pointer
+/// plus the byte length (excluding the terminator).
+pub fn pin_str(s: &str) -> (*const c_char, i32) {
+    let ptr = alloc(s.len() + 1);
+    unsafe {
+        std::ptr::copy_nonoverlapping(s.as_ptr(), ptr, s.len());
+        *ptr.add(s.len()) = 0;
+    }
+    (ptr as *const c_char, s.len() as i32)
+}
+
+/// Rewinds the arena at the tick boundary, invalidating every outstanding pointer while
+/// keeping the chunks themselves for reuse.
+pub fn reset() {
+    let mut arena = ARENA.lock();
+    arena.chunk_index = 0;
+    arena.offset = 0;
+}
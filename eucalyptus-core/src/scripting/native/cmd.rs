@@ -0,0 +1,119 @@
+//! A deferred command buffer for the mutating FFI calls.
+//!
+//! `dropbear_cmd_begin` opens a recording, the `dropbear_cmd_set_*` exports append writes
+//! without touching (or borrowing) the world, and `dropbear_cmd_submit` applies everything
+//! in one pass. Before applying, the writes are sorted by entity so that repeated writes to
+//! the same entity resolve it once and the world walk stays cache-coherent, instead of
+//! bouncing between archetypes in script call order.
+
+use crate::states::{ModelProperties, Value};
+use dropbear_engine::entity::{EntityTransform, MeshRenderer, Transform};
+use hecs::World;
+use std::cell::RefCell;
+
+/// A single recorded write.
+pub enum CommandWrite {
+    /// Replaces both the local and world transform of the entity.
+    Transform { local: Transform, world: Transform },
+    /// Sets (or creates) a property by its label.
+    Property { label: String, value: Value },
+}
+
+struct PendingWrite {
+    entity_id: i64,
+    write: CommandWrite,
+}
+
+struct CommandBuffer {
+    /// The world captured at `begin`, stored as an address because the buffer outlives
+    /// the individual FFI calls. Only dereferenced inside `submit`.
+    world: usize,
+    writes: Vec<PendingWrite>,
+    recording: bool,
+}
+
+thread_local! {
+    static COMMAND_BUFFER: RefCell<CommandBuffer> = RefCell::new(CommandBuffer {
+        world: 0,
+        writes: Vec::new(),
+        recording: false,
+    });
+}
+
+/// Starts a new recording against the given world. Any writes left over from an
+/// unsubmitted previous recording are dropped.
+pub fn begin(world_ptr: usize) {
+    COMMAND_BUFFER.with(|buffer| {
+        let mut buffer = buffer.borrow_mut();
+        buffer.world = world_ptr;
+        buffer.writes.clear();
+        buffer.recording = true;
+    });
+}
+
+/// Appends a write to the current recording. Returns `false` when no recording is open.
+pub fn record(entity_id: i64, write: CommandWrite) -> bool {
+    COMMAND_BUFFER.with(|buffer| {
+        let mut buffer = buffer.borrow_mut();
+        if !buffer.recording {
+            return false;
+        }
+        buffer.writes.push(PendingWrite { entity_id, write });
+        true
+    })
+}
+
+/// Sorts the recorded writes by entity and applies them in one pass over the world.
+///
+/// Returns the number of writes applied, or [`None`] when no recording is open.
+pub fn submit() -> Option<i32> {
+    COMMAND_BUFFER.with(|buffer| {
+        let mut buffer = buffer.borrow_mut();
+        if !buffer.recording {
+            return None;
+        }
+        buffer.recording = false;
+
+        let world_ptr = buffer.world as *mut World;
+        if world_ptr.is_null() {
+            buffer.writes.clear();
+            return None;
+        }
+        let world = unsafe { &mut *world_ptr };
+
+        // Stable sort keeps the relative order of writes to the same entity, so
+        // last-write-wins semantics match the call order.
+        let mut writes = std::mem::take(&mut buffer.writes);
+        writes.sort_by_key(|w| w.entity_id);
+
+        let mut applied = 0;
+        for pending in writes.drain(..) {
+            let Some(entity) = crate::scripting::native::entity_from_handle(world, pending.entity_id)
+            else {
+                continue;
+            };
+            match pending.write {
+                CommandWrite::Transform { local, world: w } => {
+                    if let Ok(transform) = world.query_one_mut::<&mut EntityTransform>(entity) {
+                        *transform.local_mut() = local;
+                        *transform.world_mut() = w;
+                        applied += 1;
+                    }
+                }
+                CommandWrite::Property { label, value } => {
+                    if let Ok((_, props)) =
+                        world.query_one_mut::<(&MeshRenderer, &mut ModelProperties)>(entity)
+                    {
+                        props.set_property(label, value);
+                        applied += 1;
+                    }
+                }
+            }
+        }
+
+        // Hand the (now empty) allocation back so the next recording reuses it.
+        buffer.writes = writes;
+
+        Some(applied)
+    })
+}
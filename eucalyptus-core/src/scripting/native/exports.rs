@@ -1,15 +1,22 @@
 use crate::camera::{CameraComponent, CameraType};
-use crate::ptr::{GraphicsPtr, InputStatePtr};
-use crate::scripting::native::DropbearNativeError;
-use crate::scripting::native::types::{NativeCamera, NativeTransform, Vector3D};
+use crate::ptr::{AssetRegistryPtr, GraphicsPtr, InputStatePtr};
+use crate::scripting::native::{DropbearNativeError, entity_from_handle};
+use crate::scripting::native::{arena, cmd, label_index, lease, pak, prefab, profiling, script_log, snapshot, transform_queue};
+use crate::scripting::native::types::{
+    NativeCamera, NativeEntityTransform, NativeInputEvent, NativeInputSnapshot, NativeTransform,
+    Vector3D,
+};
 use crate::states::{Label, ModelProperties, Value};
-use crate::utils::keycode_from_ordinal;
-use crate::window::{GraphicsCommand, WindowCommand};
+use crate::utils::{keycode_from_ordinal, ordinal_from_keycode};
+use crate::window::{DebugLineBatch, DynamicMeshBatch, GraphicsCommand, WindowCommand};
+use dropbear_engine::asset::PointerKind;
 use dropbear_engine::camera::Camera;
 use dropbear_engine::entity::{EntityTransform, MeshRenderer};
+use dropbear_engine::future::{FutureHandle, FutureQueue, FutureStatus};
 use glam::DVec3;
 use hecs::World;
 use std::ffi::{CStr, c_char};
+use winit::event::MouseButton;
 
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn dropbear_get_entity(
@@ -17,8 +24,9 @@ pub unsafe extern "C" fn dropbear_get_entity(
     world_ptr: *const World,
     out_entity: *mut i64,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_ENTITY);
     if label.is_null() || world_ptr.is_null() || out_entity.is_null() {
-        eprintln!("[dropbear_get_entity] [ERROR] received null pointer");
+        crate::record_error!("[dropbear_get_entity] [ERROR] received null pointer");
         return -1;
     }
 
@@ -27,38 +35,82 @@ pub unsafe extern "C" fn dropbear_get_entity(
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
         Err(_) => {
-            eprintln!("[dropbear_get_entity] [ERROR] invalid UTF-8 in label");
+            crate::record_error!("[dropbear_get_entity] [ERROR] invalid UTF-8 in label");
             return -108;
         }
     };
 
-    for (id, entity_label) in world.query::<&Label>().iter() {
-        if entity_label.as_str() == label_str {
-            unsafe { *out_entity = id.id() as i64 };
-            return 0;
-        }
+    if let Some(entity) = label_index::lookup(world, label_str) {
+        unsafe { *out_entity = entity.to_bits().get() as i64 };
+        return 0;
     }
 
-    eprintln!(
+    crate::record_error!(
         "[dropbear_get_entity] [ERROR] Entity with label '{}' not found",
         label_str
     );
     -3
 }
 
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_entities(
+    labels: *const *const c_char,
+    world_ptr: *const World,
+    out_entities: *mut i64,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_ENTITIES);
+    if labels.is_null() || world_ptr.is_null() || out_entities.is_null() {
+        crate::record_error!("[dropbear_get_entities] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    if count < 0 {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let labels = unsafe { std::slice::from_raw_parts(labels, count as usize) };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_entities, count as usize) };
+
+    let mut resolved = 0;
+    for (label, slot) in labels.iter().zip(out.iter_mut()) {
+        *slot = -1;
+
+        if label.is_null() {
+            continue;
+        }
+
+        let label_str = match unsafe { CStr::from_ptr(*label) }.to_str() {
+            Ok(s) => s,
+            Err(_) => continue,
+        };
+
+        if let Some(entity) = label_index::lookup(world, label_str) {
+            *slot = entity.to_bits().get() as i64;
+            resolved += 1;
+        }
+    }
+
+    resolved
+}
+
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn dropbear_get_world_transform(
     world_ptr: *const World,
     entity_id: i64,
     out_transform: *mut NativeTransform,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_WORLD_TRANSFORM);
     if world_ptr.is_null() || out_transform.is_null() {
-        eprintln!("[dropbear_get_world_transform] [ERROR] Null pointer received");
+        crate::record_error!("[dropbear_get_world_transform] [ERROR] Null pointer received");
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_id as u32) };
+    let Some(entity) = entity_from_handle(world, entity_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     match world.query_one::<&EntityTransform>(entity) {
         Ok(mut q) => {
@@ -78,14 +130,14 @@ pub unsafe extern "C" fn dropbear_get_world_transform(
                 }
                 0
             } else {
-                eprintln!(
+                crate::record_error!(
                     "[dropbear_get_transform] [ERROR] Entity has no WorldTransform component"
                 );
                 DropbearNativeError::NoSuchComponent as i32
             }
         }
         Err(_) => {
-            eprintln!("[dropbear_get_transform] [ERROR] Failed to query entity");
+            crate::record_error!("[dropbear_get_transform] [ERROR] Failed to query entity");
             DropbearNativeError::QueryFailed as i32
         }
     }
@@ -97,13 +149,16 @@ pub unsafe extern "C" fn dropbear_get_local_transform(
     entity_id: i64,
     out_transform: *mut NativeTransform,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LOCAL_TRANSFORM);
     if world_ptr.is_null() || out_transform.is_null() {
-        eprintln!("[dropbear_get_local_transform] [ERROR] Null pointer received");
+        crate::record_error!("[dropbear_get_local_transform] [ERROR] Null pointer received");
         return DropbearNativeError::NullPointer as i32;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_id as u32) };
+    let Some(entity) = entity_from_handle(world, entity_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     match world.query_one::<&EntityTransform>(entity) {
         Ok(mut q) => {
@@ -123,19 +178,125 @@ pub unsafe extern "C" fn dropbear_get_local_transform(
                 }
                 0
             } else {
-                eprintln!(
+                crate::record_error!(
                     "[dropbear_get_local_transform] [ERROR] Entity has no LocalTransform component"
                 );
                 DropbearNativeError::NoSuchComponent as i32
             }
         }
         Err(_) => {
-            eprintln!("[dropbear_get_local_transform] [ERROR] Failed to query entity");
+            crate::record_error!("[dropbear_get_local_transform] [ERROR] Failed to query entity");
             DropbearNativeError::QueryFailed as i32
         }
     }
 }
 
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_transforms_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    out_transforms: *mut NativeEntityTransform,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_TRANSFORMS_BATCH);
+    if world_ptr.is_null() || entity_ids.is_null() || out_transforms.is_null() {
+        crate::record_error!("[dropbear_get_transforms_batch] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    if count < 0 {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let ids = unsafe { std::slice::from_raw_parts(entity_ids, count as usize) };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_transforms, count as usize) };
+
+    // One world borrow for the whole array; the per-entity cost is just the lookup.
+    let mut written = 0;
+    for (id, slot) in ids.iter().zip(out.iter_mut()) {
+        let Some(entity) = entity_from_handle(world, *id) else {
+            continue;
+        };
+        if let Ok(transform) = world.get::<&EntityTransform>(entity) {
+            slot.local = NativeTransform::from_transform(transform.local());
+            slot.world = NativeTransform::from_transform(transform.world());
+            written += 1;
+        }
+    }
+
+    written
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_transforms_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    transforms: *const NativeEntityTransform,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_TRANSFORMS_BATCH);
+    if let Some(err) = mutation_guard("dropbear_set_transforms_batch") {
+        return err;
+    }
+
+    if world_ptr.is_null() || entity_ids.is_null() || transforms.is_null() {
+        crate::record_error!("[dropbear_set_transforms_batch] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    if count < 0 {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &mut *(world_ptr as *mut World) };
+    let ids = unsafe { std::slice::from_raw_parts(entity_ids, count as usize) };
+    let values = unsafe { std::slice::from_raw_parts(transforms, count as usize) };
+
+    let mut written = 0;
+    for (id, value) in ids.iter().zip(values.iter()) {
+        let Some(entity) = entity_from_handle(world, *id) else {
+            continue;
+        };
+        if let Ok(transform) = world.query_one_mut::<&mut EntityTransform>(entity) {
+            *transform.local_mut() = value.local.to_transform();
+            *transform.world_mut() = value.world.to_transform();
+            written += 1;
+        }
+    }
+
+    written
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_map_world_transforms(
+    world_ptr: *const World,
+    out_transforms: *mut *const NativeTransform,
+    out_entity_ids: *mut *const i64,
+    out_count: *mut i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::MAP_WORLD_TRANSFORMS);
+    if world_ptr.is_null()
+        || out_transforms.is_null()
+        || out_entity_ids.is_null()
+        || out_count.is_null()
+    {
+        crate::record_error!("[dropbear_map_world_transforms] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let (transforms, ids, count) = snapshot::map_world_transforms(world);
+
+    unsafe {
+        *out_transforms = transforms;
+        *out_entity_ids = ids;
+        *out_count = count;
+    }
+
+    0
+}
+
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn dropbear_get_string_property(
     world_ptr: *const World,
@@ -144,18 +305,21 @@ pub unsafe extern "C" fn dropbear_get_string_property(
     out_value: *mut c_char,
     out_value_max_length: i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_STRING_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
-        eprintln!("[dropbear_get_string_property] [ERROR] Null pointer received");
+        crate::record_error!("[dropbear_get_string_property] [ERROR] Null pointer received");
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
         Err(_) => {
-            eprintln!("[dropbear_get_string_property] [ERROR] Invalid UTF-8 in label");
+            crate::record_error!("[dropbear_get_string_property] [ERROR] Invalid UTF-8 in label");
             return -108;
         }
     };
@@ -163,7 +327,7 @@ pub unsafe extern "C" fn dropbear_get_string_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::String(val)) = props.get_property(label_str) {
+                if let Some(Value::String(val)) = props.get_property(label_str).as_ref() {
                     let bytes = val.as_bytes();
                     let copy_len = std::cmp::min(bytes.len(), (out_value_max_length - 1) as usize);
                     unsafe {
@@ -176,7 +340,7 @@ pub unsafe extern "C" fn dropbear_get_string_property(
                     }
                     0
                 } else {
-                    eprintln!(
+                    crate::record_error!(
                         "[dropbear_get_string_property] [WARN] Property not found or wrong type"
                     );
                     -3
@@ -186,7 +350,65 @@ pub unsafe extern "C" fn dropbear_get_string_property(
             }
         }
         Err(_) => {
-            eprintln!("[dropbear_get_string_property] [ERROR] Failed to query entity");
+            crate::record_error!("[dropbear_get_string_property] [ERROR] Failed to query entity");
+            -2
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_string_property_view(
+    world_ptr: *const World,
+    entity_handle: i64,
+    label: *const c_char,
+    out_ptr: *mut *const c_char,
+    out_len: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_STRING_PROPERTY_VIEW);
+    if world_ptr.is_null() || label.is_null() || out_ptr.is_null() || out_len.is_null() {
+        crate::record_error!("[dropbear_get_string_property_view] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
+        Ok(s) => s,
+        Err(_) => {
+            crate::record_error!(
+                "[dropbear_get_string_property_view] [ERROR] Invalid UTF-8 in label"
+            );
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
+
+    match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
+        Ok(mut q) => {
+            if let Some((_, props)) = q.get() {
+                if let Some(Value::String(val)) = props.get_property(label_str).as_ref() {
+                    let (ptr, len) = arena::pin_str(val);
+                    unsafe {
+                        *out_ptr = ptr;
+                        *out_len = len;
+                    }
+                    0
+                } else {
+                    crate::record_error!(
+                        "[dropbear_get_string_property_view] [WARN] Property not found or wrong type"
+                    );
+                    -3
+                }
+            } else {
+                -4
+            }
+        }
+        Err(_) => {
+            crate::record_error!(
+                "[dropbear_get_string_property_view] [ERROR] Failed to query entity"
+            );
             -2
         }
     }
@@ -199,13 +421,16 @@ pub unsafe extern "C" fn dropbear_get_int_property(
     label: *const c_char,
     out_value: *mut i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_INT_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
-        eprintln!("[dropbear_get_int_property] [ERROR] Null pointer received");
+        crate::record_error!("[dropbear_get_int_property] [ERROR] Null pointer received");
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -215,7 +440,7 @@ pub unsafe extern "C" fn dropbear_get_int_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Int(val)) = props.get_property(label_str) {
+                if let Some(Value::Int(val)) = props.get_property(label_str).as_ref() {
                     unsafe { *out_value = *val as i32 };
                     0
                 } else {
@@ -236,12 +461,15 @@ pub unsafe extern "C" fn dropbear_get_long_property(
     label: *const c_char,
     out_value: *mut i64,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LONG_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -251,7 +479,7 @@ pub unsafe extern "C" fn dropbear_get_long_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Int(val)) = props.get_property(label_str) {
+                if let Some(Value::Int(val)) = props.get_property(label_str).as_ref() {
                     unsafe { *out_value = *val };
                     0
                 } else {
@@ -272,12 +500,15 @@ pub unsafe extern "C" fn dropbear_get_float_property(
     label: *const c_char,
     out_value: *mut f32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_FLOAT_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -287,7 +518,7 @@ pub unsafe extern "C" fn dropbear_get_float_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Float(val)) = props.get_property(label_str) {
+                if let Some(Value::Float(val)) = props.get_property(label_str).as_ref() {
                     unsafe { *out_value = *val as f32 };
                     0
                 } else {
@@ -308,12 +539,15 @@ pub unsafe extern "C" fn dropbear_get_double_property(
     label: *const c_char,
     out_value: *mut f64,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_DOUBLE_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -323,7 +557,7 @@ pub unsafe extern "C" fn dropbear_get_double_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Float(val)) = props.get_property(label_str) {
+                if let Some(Value::Float(val)) = props.get_property(label_str).as_ref() {
                     unsafe { *out_value = *val };
                     0
                 } else {
@@ -344,12 +578,15 @@ pub unsafe extern "C" fn dropbear_get_bool_property(
     label: *const c_char,
     out_value: *mut i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_BOOL_PROPERTY);
     if world_ptr.is_null() || label.is_null() || out_value.is_null() {
         return -1;
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -359,7 +596,7 @@ pub unsafe extern "C" fn dropbear_get_bool_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Bool(val)) = props.get_property(label_str) {
+                if let Some(Value::Bool(val)) = props.get_property(label_str).as_ref() {
                     unsafe { *out_value = if *val { 1 } else { 0 } };
                     0
                 } else {
@@ -382,6 +619,7 @@ pub unsafe extern "C" fn dropbear_get_vec3_property(
     out_y: *mut f32,
     out_z: *mut f32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_VEC3_PROPERTY);
     if world_ptr.is_null()
         || label.is_null()
         || out_x.is_null()
@@ -392,7 +630,9 @@ pub unsafe extern "C" fn dropbear_get_vec3_property(
     }
 
     let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s,
@@ -402,7 +642,7 @@ pub unsafe extern "C" fn dropbear_get_vec3_property(
     match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
         Ok(mut q) => {
             if let Some((_, props)) = q.get() {
-                if let Some(Value::Vec3([x, y, z])) = props.get_property(label_str) {
+                if let Some(Value::Vec3([x, y, z])) = props.get_property(label_str).as_ref() {
                     unsafe {
                         *out_x = *x;
                         *out_y = *y;
@@ -427,12 +667,19 @@ pub unsafe extern "C" fn dropbear_set_string_property(
     label: *const c_char,
     value: *const c_char,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_STRING_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_string_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() || value.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -460,12 +707,19 @@ pub unsafe extern "C" fn dropbear_set_int_property(
     label: *const c_char,
     value: i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_INT_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_int_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -488,12 +742,19 @@ pub unsafe extern "C" fn dropbear_set_long_property(
     label: *const c_char,
     value: i64,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_LONG_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_long_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -516,12 +777,19 @@ pub unsafe extern "C" fn dropbear_set_float_property(
     label: *const c_char,
     value: f32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_FLOAT_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_float_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -544,12 +812,19 @@ pub unsafe extern "C" fn dropbear_set_double_property(
     label: *const c_char,
     value: f64,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_DOUBLE_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_double_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -572,12 +847,19 @@ pub unsafe extern "C" fn dropbear_set_bool_property(
     label: *const c_char,
     value: i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_BOOL_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_bool_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -602,12 +884,19 @@ pub unsafe extern "C" fn dropbear_set_vec3_property(
     y: f32,
     z: f32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_VEC3_PROPERTY);
+    if let Some(err) = mutation_guard("dropbear_set_vec3_property") {
+        return err;
+    }
+
     if world_ptr.is_null() || label.is_null() {
         return -1;
     }
 
     let world = unsafe { &mut *(world_ptr as *mut World) };
-    let entity = unsafe { world.find_entity_from_id(entity_handle as u32) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
 
     let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
         Ok(s) => s.to_string(),
@@ -623,430 +912,2388 @@ pub unsafe extern "C" fn dropbear_set_vec3_property(
     }
 }
 
-#[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_print_input_state(input_state_ptr: InputStatePtr) {
-    if input_state_ptr.is_null() {
-        eprintln!("[dropbear_print_input_state] [ERROR] Input state pointer is null");
-        return;
-    }
-
-    let input_state = unsafe { &*input_state_ptr };
-    println!("{:#?}", input_state);
-}
+/// Component bits accepted by [`dropbear_query_entities`]'s mask. Mirrored in dropbear.h.
+const QUERY_LABEL: u32 = 1 << 0;
+const QUERY_ENTITY_TRANSFORM: u32 = 1 << 1;
+const QUERY_MESH_RENDERER: u32 = 1 << 2;
+const QUERY_CAMERA: u32 = 1 << 3;
+const QUERY_MODEL_PROPERTIES: u32 = 1 << 4;
 
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_is_key_pressed(
-    input_state_ptr: InputStatePtr,
-    keycode: i32,
-    out_value: *mut i32,
+pub unsafe extern "C" fn dropbear_query_entities(
+    world_ptr: *const World,
+    component_mask: u32,
+    out_ids: *mut i64,
+    max: i32,
+    out_count: *mut i32,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_value.is_null() {
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::QUERY_ENTITIES);
+    if world_ptr.is_null() || out_ids.is_null() || out_count.is_null() || max < 0 {
+        crate::record_error!("[dropbear_query_entities] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let input = unsafe { &*input_state_ptr };
+    let known = QUERY_LABEL
+        | QUERY_ENTITY_TRANSFORM
+        | QUERY_MESH_RENDERER
+        | QUERY_CAMERA
+        | QUERY_MODEL_PROPERTIES;
+    if component_mask == 0 || component_mask & !known != 0 {
+        crate::record_error!(
+            "[dropbear_query_entities] [ERROR] invalid component mask: {:#x}",
+            component_mask
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    }
 
-    match keycode_from_ordinal(keycode) {
-        Some(k) => {
-            let is_pressed = input.pressed_keys.contains(&k);
-            unsafe { *out_value = if is_pressed { 1 } else { 0 } };
-            0
+    let world = unsafe { &*world_ptr };
+
+    let mut written = 0;
+    for entity_ref in world.iter() {
+        if component_mask & QUERY_LABEL != 0 && !entity_ref.has::<Label>() {
+            continue;
         }
-        None => {
-            eprintln!("[dropbear_is_key_pressed] [WARN] Invalid keycode");
-            unsafe { *out_value = 0 };
-            0
+        if component_mask & QUERY_ENTITY_TRANSFORM != 0 && !entity_ref.has::<EntityTransform>() {
+            continue;
+        }
+        if component_mask & QUERY_MESH_RENDERER != 0 && !entity_ref.has::<MeshRenderer>() {
+            continue;
+        }
+        if component_mask & QUERY_CAMERA != 0 && !entity_ref.has::<CameraComponent>() {
+            continue;
         }
+        if component_mask & QUERY_MODEL_PROPERTIES != 0 && !entity_ref.has::<ModelProperties>() {
+            continue;
+        }
+
+        if written < max {
+            unsafe { *out_ids.add(written as usize) = entity_ref.entity().to_bits().get() as i64 };
+        }
+        written += 1;
     }
+
+    // out_count carries the total number of matches so callers can detect a too-small
+    // buffer (written > max) and retry; the return value is what actually fits.
+    unsafe { *out_count = written };
+    std::cmp::min(written, max)
 }
 
-#[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_get_mouse_position(
-    input_state_ptr: InputStatePtr,
-    out_x: *mut f32,
-    out_y: *mut f32,
+/// Shared walk for the `_property_batch` getters: validates arguments, parses the label
+/// once, then visits the properties of each entity in `ids`, letting `read` fill the
+/// caller's output slot at that index. Returns the number of slots written.
+unsafe fn read_property_batch(
+    world_ptr: *const World,
+    ids: *const i64,
+    label: *const c_char,
+    count: i32,
+    mut read: impl FnMut(usize, &Value) -> bool,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_x.is_null() || out_y.is_null() {
-        return -1;
+    if world_ptr.is_null() || ids.is_null() || label.is_null() || count < 0 {
+        crate::record_error!("[dropbear_get_property_batch] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let input = unsafe { &*input_state_ptr };
+    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
+        Ok(s) => s,
+        Err(_) => {
+            crate::record_error!("[dropbear_get_property_batch] [ERROR] invalid UTF-8 in label");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
 
-    unsafe {
-        *out_x = input.mouse_pos.0 as f32;
-        *out_y = input.mouse_pos.1 as f32;
+    let world = unsafe { &*world_ptr };
+    let ids = unsafe { std::slice::from_raw_parts(ids, count as usize) };
+
+    let mut written = 0;
+    for (i, &id) in ids.iter().enumerate() {
+        let Some(entity) = entity_from_handle(world, id) else {
+            continue;
+        };
+        if let Ok(mut q) = world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
+            if let Some((_, props)) = q.get() {
+                if let Some(value) = props.get_property(label_str).as_ref() {
+                    if read(i, value) {
+                        written += 1;
+                    }
+                }
+            }
+        }
     }
-
-    0
+    written
 }
 
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_is_mouse_button_pressed(
-    input_state_ptr: InputStatePtr,
-    button_code: i32,
-    out_pressed: *mut i32,
+pub unsafe extern "C" fn dropbear_get_float_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut f32,
+    count: i32,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_pressed.is_null() {
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_FLOAT_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
     }
-
-    let input = unsafe { &*input_state_ptr };
-
-    match keycode_from_ordinal(button_code) {
-        None => {
-            eprintln!("[dropbear_is_mouse_button_pressed] [WARN] Invalid button code");
-            unsafe { *out_pressed = 0 };
-            return 0;
-        }
-        Some(key) => {
-            if input.pressed_keys.contains(&key) {
-                unsafe { *out_pressed = 1 };
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Float(val) = value {
+                *out_values.add(i) = *val as f32;
+                true
             } else {
-                unsafe { *out_pressed = 0 };
+                false
             }
-        }
+        })
     }
-
-    0
 }
 
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_get_mouse_delta(
-    input_state_ptr: InputStatePtr,
-    out_delta_x: *mut f32,
-    out_delta_y: *mut f32,
+pub unsafe extern "C" fn dropbear_get_int_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut i32,
+    count: i32,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_delta_x.is_null() || out_delta_y.is_null() {
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_INT_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
     }
-
-    let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
-
-    if let Some(pos) = input.mouse_delta.take() {
-        unsafe {
-            *out_delta_x = pos.0 as f32;
-            *out_delta_y = pos.1 as f32;
-        }
-    } else {
-        unsafe {
-            *out_delta_x = 0.0;
-            *out_delta_y = 0.0;
-        }
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Int(val) = value {
+                *out_values.add(i) = *val as i32;
+                true
+            } else {
+                false
+            }
+        })
     }
-
-    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_long_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut i64,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LONG_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Int(val) = value {
+                *out_values.add(i) = *val;
+                true
+            } else {
+                false
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_double_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut f64,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_DOUBLE_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Float(val) = value {
+                *out_values.add(i) = *val;
+                true
+            } else {
+                false
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_bool_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut i32,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_BOOL_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Bool(val) = value {
+                *out_values.add(i) = if *val { 1 } else { 0 };
+                true
+            } else {
+                false
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_vec3_property_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    label: *const c_char,
+    out_values: *mut Vector3D,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_VEC3_PROPERTY_BATCH);
+    if out_values.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+    unsafe {
+        read_property_batch(world_ptr, entity_ids, label, count, |i, value| {
+            if let Value::Vec3([x, y, z]) = value {
+                *out_values.add(i) = Vector3D {
+                    x: *x,
+                    y: *y,
+                    z: *z,
+                };
+                true
+            } else {
+                false
+            }
+        })
+    }
+}
+
+/// Refuses a mutating export while worker threads hold a read lease over the world.
+fn mutation_guard(fn_name: &str) -> Option<i32> {
+    if lease::active() {
+        crate::record_error!(
+            "[{}] [ERROR] refused: a world read lease is outstanding",
+            fn_name
+        );
+        Some(DropbearNativeError::ReadLeaseHeld as i32)
+    } else {
+        None
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_world_acquire_read(
+    world_ptr: *const World,
+    out_lease: *mut u64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::WORLD_ACQUIRE_READ);
+    if world_ptr.is_null() || out_lease.is_null() {
+        crate::record_error!("[dropbear_world_acquire_read] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe { *out_lease = lease::acquire() };
+    DropbearNativeError::Success as i32
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_world_release_read(lease_handle: u64) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::WORLD_RELEASE_READ);
+    if lease::release(lease_handle) {
+        DropbearNativeError::Success as i32
+    } else {
+        crate::record_error!(
+            "[dropbear_world_release_read] [ERROR] no outstanding lease for handle {}",
+            lease_handle
+        );
+        DropbearNativeError::QueryFailed as i32
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_prefab_resolve(name: *const c_char, out_handle: *mut u64) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::PREFAB_RESOLVE);
+    if name.is_null() || out_handle.is_null() {
+        crate::record_error!("[dropbear_prefab_resolve] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let name_str = match unsafe { CStr::from_ptr(name) }.to_str() {
+        Ok(s) => s,
+        Err(_) => {
+            crate::record_error!("[dropbear_prefab_resolve] [ERROR] invalid UTF-8 in name");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
+
+    unsafe { *out_handle = prefab::resolve(name_str) };
+    DropbearNativeError::Success as i32
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_spawn_batch(
+    world_ptr: *const World,
+    prefab_handle: u64,
+    transforms: *const NativeTransform,
+    count: i32,
+    out_ids: *mut i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SPAWN_BATCH);
+    if let Some(err) = mutation_guard("dropbear_spawn_batch") {
+        return err;
+    }
+
+    if world_ptr.is_null() || transforms.is_null() || out_ids.is_null() || count < 0 {
+        crate::record_error!("[dropbear_spawn_batch] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let Some(prefab_name) = prefab::name(prefab_handle) else {
+        crate::record_error!(
+            "[dropbear_spawn_batch] [ERROR] unknown prefab handle: {}",
+            prefab_handle
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
+
+    let world = unsafe { &mut *(world_ptr as *mut World) };
+
+    // The prefab is a live donor entity carrying the renderer and properties to clone.
+    let Some(donor) = label_index::lookup(world, &prefab_name) else {
+        crate::record_error!(
+            "[dropbear_spawn_batch] [ERROR] no entity labelled '{}' to clone from",
+            prefab_name
+        );
+        return DropbearNativeError::EntityNotFound as i32;
+    };
+
+    let donor_renderer = world
+        .get::<&MeshRenderer>(donor)
+        .ok()
+        .map(|renderer| (*renderer).clone());
+    let donor_props = world
+        .get::<&ModelProperties>(donor)
+        .ok()
+        .map(|props| (*props).clone());
+
+    let transforms = unsafe { std::slice::from_raw_parts(transforms, count as usize) };
+
+    for (i, native_transform) in transforms.iter().enumerate() {
+        let world_transform = native_transform.to_transform();
+        let label = Label::from(prefab::next_spawn_label(&prefab_name));
+        let transform = EntityTransform::new_from_world(world_transform);
+        let props = donor_props.clone().unwrap_or_default();
+
+        let entity = if let Some(renderer) = donor_renderer.clone() {
+            world.spawn((label, renderer, transform, props))
+        } else {
+            world.spawn((label, transform, props))
+        };
+
+        unsafe { *out_ids.add(i) = entity.to_bits().get() as i64 };
+    }
+
+    label_index::invalidate();
+    count
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_despawn_batch(
+    world_ptr: *const World,
+    entity_ids: *const i64,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::DESPAWN_BATCH);
+    if let Some(err) = mutation_guard("dropbear_despawn_batch") {
+        return err;
+    }
+
+    if world_ptr.is_null() || entity_ids.is_null() || count < 0 {
+        crate::record_error!("[dropbear_despawn_batch] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &mut *(world_ptr as *mut World) };
+    let ids = unsafe { std::slice::from_raw_parts(entity_ids, count as usize) };
+
+    let mut despawned = 0;
+    for &id in ids {
+        let Some(entity) = entity_from_handle(world, id) else {
+            continue;
+        };
+        if world.despawn(entity).is_ok() {
+            despawned += 1;
+        }
+    }
+
+    if despawned > 0 {
+        label_index::invalidate();
+    }
+    despawned
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_begin(world_ptr: *const World) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_BEGIN);
+    if world_ptr.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    cmd::begin(world_ptr as usize);
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_transform(
+    entity_id: i64,
+    transform: *const NativeEntityTransform,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_TRANSFORM);
+    if transform.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let transform = unsafe { &*transform };
+    let write = cmd::CommandWrite::Transform {
+        local: transform.local.to_transform(),
+        world: transform.world.to_transform(),
+    };
+
+    if cmd::record(entity_id, write) {
+        0
+    } else {
+        DropbearNativeError::QueryFailed as i32
+    }
+}
+
+/// Shared plumbing for the `dropbear_cmd_set_*_property` family: converts the label and
+/// appends the write to the open recording.
+unsafe fn record_property_write(entity_id: i64, label: *const c_char, value: Value) -> i32 {
+    if label.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
+        Ok(s) => s.to_string(),
+        Err(_) => return DropbearNativeError::InvalidUTF8 as i32,
+    };
+
+    if cmd::record(
+        entity_id,
+        cmd::CommandWrite::Property {
+            label: label_str,
+            value,
+        },
+    ) {
+        0
+    } else {
+        DropbearNativeError::QueryFailed as i32
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_string_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: *const c_char,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_STRING_PROPERTY);
+    if value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let value_str = match unsafe { CStr::from_ptr(value) }.to_str() {
+        Ok(s) => s.to_string(),
+        Err(_) => return DropbearNativeError::InvalidUTF8 as i32,
+    };
+
+    unsafe { record_property_write(entity_id, label, Value::String(value_str)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_int_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_INT_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Int(value as i64)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_long_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_LONG_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Int(value)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_float_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_FLOAT_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Float(value as f64)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_double_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: f64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_DOUBLE_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Float(value)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_bool_property(
+    entity_id: i64,
+    label: *const c_char,
+    value: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_BOOL_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Bool(value != 0)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_set_vec3_property(
+    entity_id: i64,
+    label: *const c_char,
+    x: f32,
+    y: f32,
+    z: f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SET_VEC3_PROPERTY);
+    unsafe { record_property_write(entity_id, label, Value::Vec3([x, y, z])) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_cmd_submit() -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::CMD_SUBMIT);
+    if let Some(err) = mutation_guard("dropbear_cmd_submit") {
+        return err;
+    }
+
+    match cmd::submit() {
+        Some(applied) => applied,
+        None => DropbearNativeError::QueryFailed as i32,
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_resolve_property_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    label: *const c_char,
+    out_id: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::RESOLVE_PROPERTY_ID);
+    if world_ptr.is_null() || label.is_null() || out_id.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
+        Ok(s) => s,
+        Err(_) => return DropbearNativeError::InvalidUTF8 as i32,
+    };
+
+    match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
+        Ok(mut q) => {
+            if let Some((_, props)) = q.get() {
+                if let Some(id) = props.resolve_property_id(label_str) {
+                    unsafe { *out_id = id as i32 };
+                    0
+                } else {
+                    -3
+                }
+            } else {
+                -4
+            }
+        }
+        Err(_) => -2,
+    }
+}
+
+/// Shared plumbing for the `_by_id` property getters: validates the world pointer, queries
+/// the entity's properties and hands the resolved [`Value`] to `read`.
+unsafe fn read_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    read: impl FnOnce(&Value) -> i32,
+) -> i32 {
+    if world_ptr.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one::<(&MeshRenderer, &ModelProperties)>(entity) {
+        Ok(mut q) => {
+            if let Some((_, props)) = q.get() {
+                if let Some(value) = props.get_property_by_id(property_id as u64) {
+                    read(&value)
+                } else {
+                    -3
+                }
+            } else {
+                -4
+            }
+        }
+        Err(_) => -2,
+    }
+}
+
+/// Shared plumbing for the `_by_id` property setters.
+unsafe fn write_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: Value,
+) -> i32 {
+    if let Some(err) = mutation_guard("dropbear_set_property_by_id") {
+        return err;
+    }
+
+    if world_ptr.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &mut *(world_ptr as *mut World) };
+    let Some(entity) = entity_from_handle(world, entity_handle) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one_mut::<(&MeshRenderer, &mut ModelProperties)>(entity) {
+        Ok((_, props)) => {
+            if props.set_property_by_id(property_id as u64, value) {
+                0
+            } else {
+                -3
+            }
+        }
+        Err(_) => -2,
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_string_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut c_char,
+    out_value_max_length: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_STRING_PROPERTY_BY_ID);
+    if out_value.is_null() || out_value_max_length <= 0 {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::String(val) = value {
+                let bytes = val.as_bytes();
+                let copy_len = std::cmp::min(bytes.len(), (out_value_max_length - 1) as usize);
+                std::ptr::copy_nonoverlapping(bytes.as_ptr(), out_value as *mut u8, copy_len);
+                *out_value.add(copy_len) = 0;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_int_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_INT_PROPERTY_BY_ID);
+    if out_value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Int(val) = value {
+                *out_value = *val as i32;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_long_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LONG_PROPERTY_BY_ID);
+    if out_value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Int(val) = value {
+                *out_value = *val;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_float_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_FLOAT_PROPERTY_BY_ID);
+    if out_value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Float(val) = value {
+                *out_value = *val as f32;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_double_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut f64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_DOUBLE_PROPERTY_BY_ID);
+    if out_value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Float(val) = value {
+                *out_value = *val;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_bool_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_value: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_BOOL_PROPERTY_BY_ID);
+    if out_value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Bool(val) = value {
+                *out_value = if *val { 1 } else { 0 };
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_vec3_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    out_x: *mut f32,
+    out_y: *mut f32,
+    out_z: *mut f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_VEC3_PROPERTY_BY_ID);
+    if out_x.is_null() || out_y.is_null() || out_z.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    unsafe {
+        read_property_by_id(world_ptr, entity_handle, property_id, |value| {
+            if let Value::Vec3([x, y, z]) = value {
+                *out_x = *x;
+                *out_y = *y;
+                *out_z = *z;
+                0
+            } else {
+                -3
+            }
+        })
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_string_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: *const c_char,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_STRING_PROPERTY_BY_ID);
+    if value.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let value_str = match unsafe { CStr::from_ptr(value) }.to_str() {
+        Ok(s) => s.to_string(),
+        Err(_) => return DropbearNativeError::InvalidUTF8 as i32,
+    };
+
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::String(value_str)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_int_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_INT_PROPERTY_BY_ID);
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::Int(value as i64)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_long_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_LONG_PROPERTY_BY_ID);
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::Int(value)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_float_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_FLOAT_PROPERTY_BY_ID);
+    unsafe {
+        write_property_by_id(world_ptr, entity_handle, property_id, Value::Float(value as f64))
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_double_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: f64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_DOUBLE_PROPERTY_BY_ID);
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::Float(value)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_bool_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    value: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_BOOL_PROPERTY_BY_ID);
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::Bool(value != 0)) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_vec3_property_by_id(
+    world_ptr: *const World,
+    entity_handle: i64,
+    property_id: i32,
+    x: f32,
+    y: f32,
+    z: f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_VEC3_PROPERTY_BY_ID);
+    unsafe { write_property_by_id(world_ptr, entity_handle, property_id, Value::Vec3([x, y, z])) }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_print_input_state(input_state_ptr: InputStatePtr) {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::PRINT_INPUT_STATE);
+    if input_state_ptr.is_null() {
+        crate::record_error!("[dropbear_print_input_state] [ERROR] Input state pointer is null");
+        return;
+    }
+
+    let input_state = unsafe { &*input_state_ptr };
+    println!("{:#?}", input_state);
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_input_snapshot(
+    input_state_ptr: InputStatePtr,
+    out_snapshot: *mut NativeInputSnapshot,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_INPUT_SNAPSHOT);
+    if input_state_ptr.is_null() || out_snapshot.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
+    let snapshot = unsafe { &mut *out_snapshot };
+
+    snapshot.key_bitset = [0; 4];
+    for key in &input.pressed_keys {
+        if let Some(ordinal) = ordinal_from_keycode(*key) {
+            snapshot.key_bitset[(ordinal / 64) as usize] |= 1u64 << (ordinal % 64);
+        }
+    }
+
+    snapshot.mouse_button_mask = 0;
+    for button in &input.mouse_button {
+        let bit = match button {
+            MouseButton::Left => 0,
+            MouseButton::Right => 1,
+            MouseButton::Middle => 2,
+            MouseButton::Back => 3,
+            MouseButton::Forward => 4,
+            MouseButton::Other(n) => {
+                let bit = 5 + *n as u32;
+                if bit > 31 {
+                    continue;
+                }
+                bit
+            }
+        };
+        snapshot.mouse_button_mask |= 1 << bit;
+    }
+
+    snapshot.mouse_x = input.mouse_pos.0 as f32;
+    snapshot.mouse_y = input.mouse_pos.1 as f32;
+
+    if let Some(pos) = input.last_mouse_pos {
+        snapshot.last_mouse_x = pos.0 as f32;
+        snapshot.last_mouse_y = pos.1 as f32;
+        snapshot.has_last_mouse_pos = 1;
+    } else {
+        snapshot.last_mouse_x = 0.0;
+        snapshot.last_mouse_y = 0.0;
+        snapshot.has_last_mouse_pos = 0;
+    }
+
+    // Consumes the delta, just like dropbear_get_mouse_delta does.
+    if let Some(delta) = input.mouse_delta.take() {
+        snapshot.mouse_delta_x = delta.0 as f32;
+        snapshot.mouse_delta_y = delta.1 as f32;
+    } else {
+        snapshot.mouse_delta_x = 0.0;
+        snapshot.mouse_delta_y = 0.0;
+    }
+
+    snapshot.is_cursor_locked = if input.is_cursor_locked { 1 } else { 0 };
+    snapshot.is_cursor_hidden = if input.is_cursor_hidden { 1 } else { 0 };
+
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_key_bitset(
+    input_state_ptr: InputStatePtr,
+    out_words: *mut u64,
+    word_count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_KEY_BITSET);
+    if input_state_ptr.is_null() || out_words.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    if word_count < 0 {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+    let words = unsafe { std::slice::from_raw_parts_mut(out_words, word_count as usize) };
+    words.fill(0);
+
+    for key in &input.pressed_keys {
+        if let Some(ordinal) = ordinal_from_keycode(*key) {
+            let word = (ordinal / 64) as usize;
+            if word < words.len() {
+                words[word] |= 1u64 << (ordinal % 64);
+            }
+        }
+    }
+
+    words.len() as i32
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_is_key_pressed(
+    input_state_ptr: InputStatePtr,
+    keycode: i32,
+    out_value: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::IS_KEY_PRESSED);
+    if input_state_ptr.is_null() || out_value.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+
+    match keycode_from_ordinal(keycode) {
+        Some(k) => {
+            let is_pressed = input.pressed_keys.contains(&k);
+            unsafe { *out_value = if is_pressed { 1 } else { 0 } };
+            0
+        }
+        None => {
+            crate::record_error!("[dropbear_is_key_pressed] [WARN] Invalid keycode");
+            unsafe { *out_value = 0 };
+            0
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_mouse_position(
+    input_state_ptr: InputStatePtr,
+    out_x: *mut f32,
+    out_y: *mut f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_MOUSE_POSITION);
+    if input_state_ptr.is_null() || out_x.is_null() || out_y.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+
+    unsafe {
+        *out_x = input.mouse_pos.0 as f32;
+        *out_y = input.mouse_pos.1 as f32;
+    }
+
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_is_mouse_button_pressed(
+    input_state_ptr: InputStatePtr,
+    button_code: i32,
+    out_pressed: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::IS_MOUSE_BUTTON_PRESSED);
+    if input_state_ptr.is_null() || out_pressed.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+
+    match keycode_from_ordinal(button_code) {
+        None => {
+            crate::record_error!("[dropbear_is_mouse_button_pressed] [WARN] Invalid button code");
+            unsafe { *out_pressed = 0 };
+            return 0;
+        }
+        Some(key) => {
+            if input.pressed_keys.contains(&key) {
+                unsafe { *out_pressed = 1 };
+            } else {
+                unsafe { *out_pressed = 0 };
+            }
+        }
+    }
+
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_mouse_delta(
+    input_state_ptr: InputStatePtr,
+    out_delta_x: *mut f32,
+    out_delta_y: *mut f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_MOUSE_DELTA);
+    if input_state_ptr.is_null() || out_delta_x.is_null() || out_delta_y.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
+
+    if let Some(pos) = input.mouse_delta.take() {
+        unsafe {
+            *out_delta_x = pos.0 as f32;
+            *out_delta_y = pos.1 as f32;
+        }
+    } else {
+        unsafe {
+            *out_delta_x = 0.0;
+            *out_delta_y = 0.0;
+        }
+    }
+
+    0
 }
 
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn dropbear_is_cursor_locked(
     input_state_ptr: InputStatePtr,
-    out_locked: *mut i32,
+    out_locked: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::IS_CURSOR_LOCKED);
+    if input_state_ptr.is_null() || out_locked.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+
+    unsafe { *out_locked = if input.is_cursor_locked { 1 } else { 0 } };
+
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_cursor_locked(
+    queue_ptr: GraphicsPtr,
+    input_state_ptr: InputStatePtr,
+    locked: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_CURSOR_LOCKED);
+    if input_state_ptr.is_null() || queue_ptr.is_null() {
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
+
+    let graphics = unsafe { &*(queue_ptr as GraphicsPtr) };
+
+    input.is_cursor_locked = locked != 0;
+
+    if graphics
+        .send(GraphicsCommand::WindowCommand(WindowCommand::WindowGrab(
+            input.is_cursor_locked,
+        )))
+        .is_err()
+    {
+        DropbearNativeError::SendError as i32
+    } else {
+        0
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_camera(
+    world_ptr: *const World,
+    label: *const c_char,
+    out_camera: *mut NativeCamera,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_CAMERA);
+    if world_ptr.is_null() || label.is_null() || out_camera.is_null() {
+        crate::record_error!("[dropbear_get_camera] [ERROR] Null pointer received");
+        return -1;
+    }
+
+    let world = unsafe { &*world_ptr };
+
+    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
+        Ok(s) => s,
+        Err(_) => {
+            crate::record_error!("[dropbear_get_camera] [ERROR] Invalid UTF-8 in label");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
+
+    if let Some((id, (cam, comp))) = world
+        .query::<(&Camera, &CameraComponent)>()
+        .iter()
+        .find(|(_, (cam, _))| cam.label == label_str)
+    {
+        if matches!(comp.camera_type, CameraType::Debug) {
+            crate::record_error!("[dropbear_get_camera] [WARN] Querying a CameraType::Debug is illegal");
+            return -5;
+        }
+
+        // We need to allocate the label string on the heap so it persists
+        // The caller should be aware this needs to be managed
+        let label_cstring = std::ffi::CString::new(cam.label.as_str()).unwrap();
+
+        unsafe {
+            (*out_camera).label = label_cstring.into_raw();
+            (*out_camera).entity_id = id.to_bits().get() as i64;
+
+            (*out_camera).eye = Vector3D {
+                x: cam.eye.x as f32,
+                y: cam.eye.y as f32,
+                z: cam.eye.z as f32,
+            };
+
+            (*out_camera).target = Vector3D {
+                x: cam.target.x as f32,
+                y: cam.target.y as f32,
+                z: cam.target.z as f32,
+            };
+
+            (*out_camera).up = Vector3D {
+                x: cam.up.x as f32,
+                y: cam.up.y as f32,
+                z: cam.up.z as f32,
+            };
+
+            (*out_camera).aspect = cam.aspect;
+            (*out_camera).fov_y = cam.settings.fov_y;
+            (*out_camera).znear = cam.znear;
+            (*out_camera).zfar = cam.zfar;
+            (*out_camera).yaw = cam.yaw;
+            (*out_camera).pitch = cam.pitch;
+            (*out_camera).speed = cam.settings.speed;
+            (*out_camera).sensitivity = cam.settings.sensitivity;
+        }
+
+        return 0;
+    }
+
+    crate::record_error!(
+        "[dropbear_get_camera] [ERROR] Camera with label '{}' not found",
+        label_str
+    );
+    -3
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_attached_camera(
+    world_ptr: *const World,
+    id: i64,
+    out_camera: *mut NativeCamera,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_ATTACHED_CAMERA);
+    if world_ptr.is_null() || out_camera.is_null() {
+        crate::record_error!("[dropbear_get_attached_camera] [ERROR] Null pointer received");
+        return -1;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one::<(&Camera, &CameraComponent)>(entity) {
+        Ok(mut q) => {
+            if let Some((cam, comp)) = q.get() {
+                if matches!(comp.camera_type, CameraType::Debug) {
+                    crate::record_error!(
+                        "[dropbear_get_attached_camera] [WARN] Querying a CameraType::Debug is illegal"
+                    );
+                    return -5;
+                }
+
+                let label_cstring = std::ffi::CString::new(cam.label.as_str()).unwrap();
+
+                unsafe {
+                    (*out_camera).label = label_cstring.into_raw();
+                    (*out_camera).entity_id = id;
+
+                    (*out_camera).eye = Vector3D {
+                        x: cam.eye.x as f32,
+                        y: cam.eye.y as f32,
+                        z: cam.eye.z as f32,
+                    };
+
+                    (*out_camera).target = Vector3D {
+                        x: cam.target.x as f32,
+                        y: cam.target.y as f32,
+                        z: cam.target.z as f32,
+                    };
+
+                    (*out_camera).up = Vector3D {
+                        x: cam.up.x as f32,
+                        y: cam.up.y as f32,
+                        z: cam.up.z as f32,
+                    };
+
+                    (*out_camera).aspect = cam.aspect;
+                    (*out_camera).fov_y = cam.settings.fov_y;
+                    (*out_camera).znear = cam.znear;
+                    (*out_camera).zfar = cam.zfar;
+                    (*out_camera).yaw = cam.yaw;
+                    (*out_camera).pitch = cam.pitch;
+                    (*out_camera).speed = cam.settings.speed;
+                    (*out_camera).sensitivity = cam.settings.sensitivity;
+                }
+
+                0
+            } else {
+                crate::record_error!("[dropbear_get_attached_camera] [ERROR] Entity has no Camera component");
+                -4
+            }
+        }
+        Err(_) => {
+            crate::record_error!("[dropbear_get_attached_camera] [ERROR] Failed to query entity");
+            -2
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_camera(
+    world_ptr: *mut World,
+    camera: *const NativeCamera,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_CAMERA);
+    if let Some(err) = mutation_guard("dropbear_set_camera") {
+        return err;
+    }
+
+    if world_ptr.is_null() || camera.is_null() {
+        crate::record_error!("[dropbear_set_camera] [ERROR] Null pointer received");
+        return -1;
+    }
+
+    let world = unsafe { &mut *(world_ptr) };
+    let cam_data = unsafe { &*camera };
+
+    let Some(entity) = entity_from_handle(world, cam_data.entity_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one_mut::<&mut Camera>(entity) {
+        Ok(cam) => {
+            cam.eye = DVec3::new(
+                cam_data.eye.x as f64,
+                cam_data.eye.y as f64,
+                cam_data.eye.z as f64,
+            );
+
+            cam.target = DVec3::new(
+                cam_data.target.x as f64,
+                cam_data.target.y as f64,
+                cam_data.target.z as f64,
+            );
+
+            cam.up = DVec3::new(
+                cam_data.up.x as f64,
+                cam_data.up.y as f64,
+                cam_data.up.z as f64,
+            );
+
+            cam.aspect = cam_data.aspect;
+            cam.settings.fov_y = cam_data.fov_y;
+            cam.znear = cam_data.znear;
+            cam.zfar = cam_data.zfar;
+            cam.yaw = cam_data.yaw;
+            cam.pitch = cam_data.pitch;
+            cam.settings.speed = cam_data.speed;
+            cam.settings.sensitivity = cam_data.sensitivity;
+
+            0
+        }
+        Err(_) => {
+            crate::record_error!("[dropbear_set_camera] [ERROR] Unable to query camera component");
+            -2
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_camera_matrices(
+    world_ptr: *const World,
+    entity_id: i64,
+    out_view16: *mut f32,
+    out_proj16: *mut f32,
+    out_viewproj16: *mut f32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_CAMERA_MATRICES);
+    if world_ptr.is_null() {
+        crate::record_error!("[dropbear_get_camera_matrices] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, entity_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one::<&Camera>(entity) {
+        Ok(mut q) => {
+            if let Some(cam) = q.get() {
+                // These are the matrices the renderer computed for the current frame;
+                // nothing is rebuilt here, just cast down to f32 column-major.
+                let write = |out: *mut f32, mat: glam::DMat4| {
+                    if !out.is_null() {
+                        let cols = mat.to_cols_array();
+                        for (i, value) in cols.iter().enumerate() {
+                            unsafe { *out.add(i) = *value as f32 };
+                        }
+                    }
+                };
+
+                write(out_view16, cam.view_mat);
+                write(out_proj16, cam.proj_mat);
+                write(
+                    out_viewproj16,
+                    glam::DMat4::from_cols_array_2d(&dropbear_engine::camera::OPENGL_TO_WGPU_MATRIX)
+                        * cam.proj_mat
+                        * cam.view_mat,
+                );
+
+                DropbearNativeError::Success as i32
+            } else {
+                DropbearNativeError::NoSuchComponent as i32
+            }
+        }
+        Err(_) => {
+            crate::record_error!(
+                "[dropbear_get_camera_matrices] [ERROR] Unable to query camera component"
+            );
+            DropbearNativeError::QueryFailed as i32
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_world_to_screen(
+    world_ptr: *const World,
+    camera_id: i64,
+    points: *const Vector3D,
+    out_xy: *mut f32,
+    count: i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::WORLD_TO_SCREEN);
+    if world_ptr.is_null() || points.is_null() || out_xy.is_null() || count < 0 {
+        crate::record_error!("[dropbear_world_to_screen] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    let Some(entity) = entity_from_handle(world, camera_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    let view_proj = match world.query_one::<&Camera>(entity) {
+        Ok(mut q) => {
+            if let Some(cam) = q.get() {
+                glam::DMat4::from_cols_array_2d(&dropbear_engine::camera::OPENGL_TO_WGPU_MATRIX)
+                    * cam.proj_mat
+                    * cam.view_mat
+            } else {
+                return DropbearNativeError::NoSuchComponent as i32;
+            }
+        }
+        Err(_) => {
+            crate::record_error!(
+                "[dropbear_world_to_screen] [ERROR] Unable to query camera component"
+            );
+            return DropbearNativeError::QueryFailed as i32;
+        }
+    };
+
+    let points = unsafe { std::slice::from_raw_parts(points, count as usize) };
+
+    let mut visible = 0;
+    for (i, point) in points.iter().enumerate() {
+        let clip = view_proj
+            * glam::DVec4::new(point.x as f64, point.y as f64, point.z as f64, 1.0);
+
+        if clip.w > 0.0 {
+            // Normalised screen coordinates: (0,0) top-left, (1,1) bottom-right.
+            let x = (clip.x / clip.w + 1.0) * 0.5;
+            let y = (1.0 - clip.y / clip.w) * 0.5;
+            unsafe {
+                *out_xy.add(i * 2) = x as f32;
+                *out_xy.add(i * 2 + 1) = y as f32;
+            }
+            visible += 1;
+        } else {
+            // Behind the camera; flagged so scripts can skip the point without a
+            // separate visibility array.
+            unsafe {
+                *out_xy.add(i * 2) = -1.0;
+                *out_xy.add(i * 2 + 1) = -1.0;
+            }
+        }
+    }
+
+    visible
+}
+
+/// Field bits accepted by [`dropbear_set_camera_fields`]'s mask. Mirrored in dropbear.h.
+const CAMERA_FIELD_EYE: u32 = 1 << 0;
+const CAMERA_FIELD_TARGET: u32 = 1 << 1;
+const CAMERA_FIELD_UP: u32 = 1 << 2;
+const CAMERA_FIELD_PROJECTION: u32 = 1 << 3;
+const CAMERA_FIELD_YAW: u32 = 1 << 4;
+const CAMERA_FIELD_PITCH: u32 = 1 << 5;
+const CAMERA_FIELD_SPEED: u32 = 1 << 6;
+const CAMERA_FIELD_SENSITIVITY: u32 = 1 << 7;
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_camera_fields(
+    world_ptr: *mut World,
+    entity_id: i64,
+    field_mask: u32,
+    partial: *const NativeCamera,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_CAMERA_FIELDS);
+    if let Some(err) = mutation_guard("dropbear_set_camera_fields") {
+        return err;
+    }
+
+    if world_ptr.is_null() || partial.is_null() {
+        crate::record_error!("[dropbear_set_camera_fields] [ERROR] Null pointer received");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let known = CAMERA_FIELD_EYE
+        | CAMERA_FIELD_TARGET
+        | CAMERA_FIELD_UP
+        | CAMERA_FIELD_PROJECTION
+        | CAMERA_FIELD_YAW
+        | CAMERA_FIELD_PITCH
+        | CAMERA_FIELD_SPEED
+        | CAMERA_FIELD_SENSITIVITY;
+    if field_mask == 0 || field_mask & !known != 0 {
+        crate::record_error!(
+            "[dropbear_set_camera_fields] [ERROR] invalid field mask: {:#x}",
+            field_mask
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    }
+
+    let world = unsafe { &mut *world_ptr };
+    let cam_data = unsafe { &*partial };
+
+    // Unlike dropbear_set_camera, the entity comes in as a parameter and the label pointer
+    // inside the struct is never touched, so a two-double yaw/pitch nudge stays exactly that.
+    let Some(entity) = entity_from_handle(world, entity_id) else {
+        return DropbearNativeError::NoSuchEntity as i32;
+    };
+
+    match world.query_one_mut::<&mut Camera>(entity) {
+        Ok(cam) => {
+            if field_mask & CAMERA_FIELD_EYE != 0 {
+                cam.eye = DVec3::new(
+                    cam_data.eye.x as f64,
+                    cam_data.eye.y as f64,
+                    cam_data.eye.z as f64,
+                );
+            }
+            if field_mask & CAMERA_FIELD_TARGET != 0 {
+                cam.target = DVec3::new(
+                    cam_data.target.x as f64,
+                    cam_data.target.y as f64,
+                    cam_data.target.z as f64,
+                );
+            }
+            if field_mask & CAMERA_FIELD_UP != 0 {
+                cam.up = DVec3::new(
+                    cam_data.up.x as f64,
+                    cam_data.up.y as f64,
+                    cam_data.up.z as f64,
+                );
+            }
+            if field_mask & CAMERA_FIELD_PROJECTION != 0 {
+                cam.aspect = cam_data.aspect;
+                cam.settings.fov_y = cam_data.fov_y;
+                cam.znear = cam_data.znear;
+                cam.zfar = cam_data.zfar;
+            }
+            if field_mask & CAMERA_FIELD_YAW != 0 {
+                cam.yaw = cam_data.yaw;
+            }
+            if field_mask & CAMERA_FIELD_PITCH != 0 {
+                cam.pitch = cam_data.pitch;
+            }
+            if field_mask & CAMERA_FIELD_SPEED != 0 {
+                cam.settings.speed = cam_data.speed;
+            }
+            if field_mask & CAMERA_FIELD_SENSITIVITY != 0 {
+                cam.settings.sensitivity = cam_data.sensitivity;
+            }
+
+            DropbearNativeError::Success as i32
+        }
+        Err(_) => {
+            crate::record_error!(
+                "[dropbear_set_camera_fields] [ERROR] Unable to query camera component"
+            );
+            DropbearNativeError::QueryFailed as i32
+        }
+    }
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_get_last_mouse_pos(
+    input_state_ptr: InputStatePtr,
+    out_x: *mut f32,
+    out_y: *mut f32,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_locked.is_null() {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LAST_MOUSE_POS);
+    if input_state_ptr.is_null() || out_x.is_null() || out_y.is_null() {
         return -1;
     }
 
     let input = unsafe { &*input_state_ptr };
 
-    unsafe { *out_locked = if input.is_cursor_locked { 1 } else { 0 } };
+    if let Some(pos) = input.last_mouse_pos {
+        unsafe {
+            *out_x = pos.0 as f32;
+            *out_y = pos.1 as f32;
+        }
+    } else {
+        unsafe {
+            *out_x = 0.0;
+            *out_y = 0.0;
+        }
+    }
 
     0
 }
 
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_set_cursor_locked(
+pub unsafe extern "C" fn dropbear_is_cursor_hidden(
+    input_state_ptr: InputStatePtr,
+    out_hidden: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::IS_CURSOR_HIDDEN);
+    if input_state_ptr.is_null() || out_hidden.is_null() {
+        return -1;
+    }
+
+    let input = unsafe { &*input_state_ptr };
+
+    unsafe { *out_hidden = if input.is_cursor_hidden { 1 } else { 0 } };
+
+    0
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_cursor_hidden(
     queue_ptr: GraphicsPtr,
     input_state_ptr: InputStatePtr,
-    locked: i32,
+    hidden: i32,
 ) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_CURSOR_HIDDEN);
     if input_state_ptr.is_null() || queue_ptr.is_null() {
         return DropbearNativeError::NullPointer as i32;
     }
 
     let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
-
     let graphics = unsafe { &*(queue_ptr as GraphicsPtr) };
-
-    input.is_cursor_locked = locked != 0;
+    input.is_cursor_hidden = hidden != 0;
 
     if graphics
-        .send(GraphicsCommand::WindowCommand(WindowCommand::WindowGrab(
-            input.is_cursor_locked,
+        .send(GraphicsCommand::WindowCommand(WindowCommand::HideCursor(
+            input.is_cursor_hidden,
         )))
         .is_err()
     {
         DropbearNativeError::SendError as i32
     } else {
-        0
+        DropbearNativeError::Success as i32
     }
 }
 
+// ===========================================
+
+/// Copies the calling thread's last recorded error message into `out_buf` (NUL-terminated,
+/// truncated to `out_buf_len`). Returns the number of bytes copied, or 0 when no error has
+/// been recorded (or verbosity is 0, in which case messages are never formatted).
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_get_camera(
-    world_ptr: *const World,
-    label: *const c_char,
-    out_camera: *mut NativeCamera,
+pub unsafe extern "C" fn dropbear_get_last_error(out_buf: *mut c_char, out_buf_len: i32) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::GET_LAST_ERROR);
+    crate::scripting::native::last_error::copy_to(out_buf as *mut u8, out_buf_len)
+}
+
+/// Sets the error verbosity: 0 = errors return only their code (default), 1 = messages are
+/// recorded for [`dropbear_get_last_error`], 2 = messages are also printed to stderr.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_error_verbosity(level: i32) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::SET_ERROR_VERBOSITY);
+    crate::scripting::native::last_error::set_verbosity(level);
+    DropbearNativeError::Success as i32
+}
+
+// ===========================================
+
+/// The payload produced by [`dropbear_asset_load_async`] futures.
+type AssetLoadResult = Result<Vec<u8>, String>;
+
+/// Fetches the engine's [`FutureQueue`] out of the asset registry's pointer database
+/// (registered by the editor under `Const("future_queue")`, same as `model_cache`).
+unsafe fn registry_future_queue<'a>(asset_ptr: AssetRegistryPtr) -> Option<&'a FutureQueue> {
+    let asset = unsafe { &*asset_ptr };
+    let ptr = asset.get_pointer(PointerKind::Const("future_queue"))?;
+    Some(unsafe { &*(ptr as *const FutureQueue) })
+}
+
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_asset_load_async(
+    asset_ptr: AssetRegistryPtr,
+    path: *const c_char,
+    out_handle: *mut u64,
 ) -> i32 {
-    if world_ptr.is_null() || label.is_null() || out_camera.is_null() {
-        eprintln!("[dropbear_get_camera] [ERROR] Null pointer received");
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::ASSET_LOAD_ASYNC);
+    if asset_ptr.is_null() || path.is_null() || out_handle.is_null() {
+        crate::record_error!("[dropbear_asset_load_async] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let world = unsafe { &*world_ptr };
-
-    let label_str = match unsafe { CStr::from_ptr(label) }.to_str() {
-        Ok(s) => s,
+    let path = match unsafe { CStr::from_ptr(path) }.to_str() {
+        Ok(s) => s.to_string(),
         Err(_) => {
-            eprintln!("[dropbear_get_camera] [ERROR] Invalid UTF-8 in label");
+            crate::record_error!("[dropbear_asset_load_async] [ERROR] invalid UTF-8 in path");
             return DropbearNativeError::InvalidUTF8 as i32;
         }
     };
 
-    if let Some((id, (cam, comp))) = world
-        .query::<(&Camera, &CameraComponent)>()
-        .iter()
-        .find(|(_, (cam, _))| cam.label == label_str)
-    {
-        if matches!(comp.camera_type, CameraType::Debug) {
-            eprintln!("[dropbear_get_camera] [WARN] Querying a CameraType::Debug is illegal");
-            return -5;
-        }
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_asset_load_async] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-        // We need to allocate the label string on the heap so it persists
-        // The caller should be aware this needs to be managed
-        let label_cstring = std::ffi::CString::new(cam.label.as_str()).unwrap();
+    let handle = queue.push(async move {
+        let result: AssetLoadResult = tokio::fs::read(&path)
+            .await
+            .map_err(|e| format!("failed to read {}: {}", path, e));
+        result
+    });
 
-        unsafe {
-            (*out_camera).label = label_cstring.into_raw();
-            (*out_camera).entity_id = id.id() as i64;
+    unsafe { *out_handle = handle.id };
+    DropbearNativeError::Success as i32
+}
 
-            (*out_camera).eye = Vector3D {
-                x: cam.eye.x as f32,
-                y: cam.eye.y as f32,
-                z: cam.eye.z as f32,
-            };
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_future_status(
+    asset_ptr: AssetRegistryPtr,
+    handle_id: u64,
+    out_status: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::FUTURE_STATUS);
+    if asset_ptr.is_null() || out_status.is_null() {
+        crate::record_error!("[dropbear_future_status] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
 
-            (*out_camera).target = Vector3D {
-                x: cam.target.x as f32,
-                y: cam.target.y as f32,
-                z: cam.target.z as f32,
-            };
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_future_status] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-            (*out_camera).up = Vector3D {
-                x: cam.up.x as f32,
-                y: cam.up.y as f32,
-                z: cam.up.z as f32,
+    match queue.get_status(&FutureHandle { id: handle_id }) {
+        Some(status) => {
+            unsafe {
+                *out_status = match status {
+                    FutureStatus::NotPolled => 0,
+                    FutureStatus::CurrentlyPolling => 1,
+                    FutureStatus::Completed => 2,
+                    FutureStatus::Cancelled => 3,
+                }
             };
+            DropbearNativeError::Success as i32
+        }
+        None => {
+            crate::record_error!(
+                "[dropbear_future_status] [ERROR] unknown future handle: {}",
+                handle_id
+            );
+            DropbearNativeError::QueryFailed as i32
+        }
+    }
+}
 
-            (*out_camera).aspect = cam.aspect;
-            (*out_camera).fov_y = cam.settings.fov_y;
-            (*out_camera).znear = cam.znear;
-            (*out_camera).zfar = cam.zfar;
-            (*out_camera).yaw = cam.yaw;
-            (*out_camera).pitch = cam.pitch;
-            (*out_camera).speed = cam.settings.speed;
-            (*out_camera).sensitivity = cam.settings.sensitivity;
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_future_exchange(
+    asset_ptr: AssetRegistryPtr,
+    handle_id: u64,
+    out_buf: *mut u8,
+    buf_len: i64,
+    out_len: *mut i64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::FUTURE_EXCHANGE);
+    if asset_ptr.is_null() || out_len.is_null() {
+        crate::record_error!("[dropbear_future_exchange] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_future_exchange] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
+
+    let Some(result) = queue.exchange(&FutureHandle { id: handle_id }) else {
+        crate::record_error!(
+            "[dropbear_future_exchange] [ERROR] future {} is not completed (or unknown)",
+            handle_id
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
+
+    let Some(load_result) = result.downcast_ref::<AssetLoadResult>() else {
+        crate::record_error!(
+            "[dropbear_future_exchange] [ERROR] future {} does not hold an asset load result",
+            handle_id
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
+
+    match load_result {
+        Ok(bytes) => {
+            unsafe { *out_len = bytes.len() as i64 };
+            if out_buf.is_null() || buf_len <= 0 {
+                return 0;
+            }
+            let copy_len = std::cmp::min(bytes.len(), buf_len as usize);
+            unsafe { std::ptr::copy_nonoverlapping(bytes.as_ptr(), out_buf, copy_len) };
+            copy_len as i32
+        }
+        Err(e) => {
+            crate::record_error!("[dropbear_future_exchange] [ERROR] {}", e);
+            DropbearNativeError::UnknownError as i32
         }
+    }
+}
 
-        return 0;
+// ===========================================
+
+/// The payload produced by [`dropbear_job_submit`] futures.
+type JobResult = Result<(), String>;
+
+/// A C job callback plus its context pointer, moved onto the worker pool as one unit.
+///
+/// Asserting [`Send`] here is the FFI contract documented in dropbear.h: the callback
+/// must be safe to run off the script thread, and `arg` must stay valid (and untouched
+/// by the script) until the job completes, errors, or is cancelled.
+struct NativeJob {
+    run: unsafe extern "C" fn(*mut std::ffi::c_void),
+    arg: *mut std::ffi::c_void,
+}
+
+unsafe impl Send for NativeJob {}
+
+impl NativeJob {
+    fn call(self) {
+        unsafe { (self.run)(self.arg) }
+    }
+}
+
+/// Submits a script callback to the engine's worker pool and hands back a future handle
+/// on the same queue the async asset loads use. The callback runs on a blocking worker
+/// thread, so CPU-heavy jobs (path solves, procedural generation) stall neither the
+/// async runtime nor the tick — and scripts no longer need ad-hoc threads of their own.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_job_submit(
+    asset_ptr: AssetRegistryPtr,
+    func: Option<unsafe extern "C" fn(*mut std::ffi::c_void)>,
+    arg: *mut std::ffi::c_void,
+    out_handle: *mut u64,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::JOB_SUBMIT);
+    if asset_ptr.is_null() || out_handle.is_null() {
+        crate::record_error!("[dropbear_job_submit] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    eprintln!(
-        "[dropbear_get_camera] [ERROR] Camera with label '{}' not found",
-        label_str
-    );
-    -3
+    let Some(func) = func else {
+        crate::record_error!("[dropbear_job_submit] [ERROR] received null callback");
+        return DropbearNativeError::NullPointer as i32;
+    };
+
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_job_submit] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
+
+    let job = NativeJob { run: func, arg };
+    let handle = queue.push(async move {
+        let result: JobResult = match tokio::task::spawn_blocking(move || job.call()).await {
+            Ok(()) => Ok(()),
+            Err(e) => Err(format!("job callback panicked: {}", e)),
+        };
+        result
+    });
+
+    unsafe { *out_handle = handle.id };
+    DropbearNativeError::Success as i32
 }
 
+/// Reports a job's status with the same codes as [`dropbear_future_status`]:
+/// 0 = queued, 1 = running, 2 = completed, 3 = cancelled.
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_get_attached_camera(
-    world_ptr: *const World,
-    id: i64,
-    out_camera: *mut NativeCamera,
+pub unsafe extern "C" fn dropbear_job_status(
+    asset_ptr: AssetRegistryPtr,
+    handle_id: u64,
+    out_status: *mut i32,
 ) -> i32 {
-    if world_ptr.is_null() || out_camera.is_null() {
-        eprintln!("[dropbear_get_attached_camera] [ERROR] Null pointer received");
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::JOB_STATUS);
+    if asset_ptr.is_null() || out_status.is_null() {
+        crate::record_error!("[dropbear_job_status] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let world = unsafe { &*world_ptr };
-    let entity = unsafe { world.find_entity_from_id(id as u32) };
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_job_status] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-    match world.query_one::<(&Camera, &CameraComponent)>(entity) {
-        Ok(mut q) => {
-            if let Some((cam, comp)) = q.get() {
-                if matches!(comp.camera_type, CameraType::Debug) {
-                    eprintln!(
-                        "[dropbear_get_attached_camera] [WARN] Querying a CameraType::Debug is illegal"
-                    );
-                    return -5;
+    match queue.get_status(&FutureHandle { id: handle_id }) {
+        Some(status) => {
+            unsafe {
+                *out_status = match status {
+                    FutureStatus::NotPolled => 0,
+                    FutureStatus::CurrentlyPolling => 1,
+                    FutureStatus::Completed => 2,
+                    FutureStatus::Cancelled => 3,
                 }
+            };
+            DropbearNativeError::Success as i32
+        }
+        None => {
+            crate::record_error!(
+                "[dropbear_job_status] [ERROR] unknown job handle: {}",
+                handle_id
+            );
+            DropbearNativeError::QueryFailed as i32
+        }
+    }
+}
 
-                let label_cstring = std::ffi::CString::new(cam.label.as_str()).unwrap();
+/// Non-blocking join. Once the job has completed this consumes its queue slot and
+/// returns 0 — or [`DropbearNativeError::UnknownError`] when the callback panicked.
+/// While the job is still pending (or the handle is unknown) it returns
+/// [`DropbearNativeError::QueryFailed`]; poll it once a frame like the asset futures
+/// rather than spinning on it inside a tick.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_job_join(asset_ptr: AssetRegistryPtr, handle_id: u64) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::JOB_JOIN);
+    if asset_ptr.is_null() {
+        crate::record_error!("[dropbear_job_join] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
 
-                unsafe {
-                    (*out_camera).label = label_cstring.into_raw();
-                    (*out_camera).entity_id = id;
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_job_join] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-                    (*out_camera).eye = Vector3D {
-                        x: cam.eye.x as f32,
-                        y: cam.eye.y as f32,
-                        z: cam.eye.z as f32,
-                    };
+    let Some(result) = queue.exchange_owned(&FutureHandle { id: handle_id }) else {
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-                    (*out_camera).target = Vector3D {
-                        x: cam.target.x as f32,
-                        y: cam.target.y as f32,
-                        z: cam.target.z as f32,
-                    };
+    match result.downcast_ref::<JobResult>() {
+        Some(Ok(())) => DropbearNativeError::Success as i32,
+        Some(Err(e)) => {
+            crate::record_error!("[dropbear_job_join] [ERROR] {}", e);
+            DropbearNativeError::UnknownError as i32
+        }
+        None => {
+            crate::record_error!(
+                "[dropbear_job_join] [ERROR] future {} does not hold a job result",
+                handle_id
+            );
+            DropbearNativeError::QueryFailed as i32
+        }
+    }
+}
 
-                    (*out_camera).up = Vector3D {
-                        x: cam.up.x as f32,
-                        y: cam.up.y as f32,
-                        z: cam.up.z as f32,
-                    };
+/// Cancels a submitted job. Returns 0 when the job was cancelled, or
+/// [`DropbearNativeError::QueryFailed`] when the handle is unknown or the job already
+/// finished. A callback already running on a worker is aborted at the task level only;
+/// the C code itself cannot be interrupted mid-call.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_job_cancel(asset_ptr: AssetRegistryPtr, handle_id: u64) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::JOB_CANCEL);
+    if asset_ptr.is_null() {
+        crate::record_error!("[dropbear_job_cancel] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
 
-                    (*out_camera).aspect = cam.aspect;
-                    (*out_camera).fov_y = cam.settings.fov_y;
-                    (*out_camera).znear = cam.znear;
-                    (*out_camera).zfar = cam.zfar;
-                    (*out_camera).yaw = cam.yaw;
-                    (*out_camera).pitch = cam.pitch;
-                    (*out_camera).speed = cam.settings.speed;
-                    (*out_camera).sensitivity = cam.settings.sensitivity;
-                }
+    let Some(queue) = (unsafe { registry_future_queue(asset_ptr) }) else {
+        crate::record_error!(
+            "[dropbear_job_cancel] [ERROR] asset registry does not contain a future queue"
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    };
 
-                0
-            } else {
-                eprintln!("[dropbear_get_attached_camera] [ERROR] Entity has no Camera component");
-                -4
-            }
-        }
-        Err(_) => {
-            eprintln!("[dropbear_get_attached_camera] [ERROR] Failed to query entity");
-            -2
-        }
+    if queue.cancel(&FutureHandle { id: handle_id }) {
+        DropbearNativeError::Success as i32
+    } else {
+        DropbearNativeError::QueryFailed as i32
     }
 }
 
+// ===========================================
+
+/// Bump-allocates `size` bytes of script-visible scratch from the frame arena. The buffer
+/// is valid until the next `dropbear_update_all` tick and must never be freed; there is no
+/// matching release call by design.
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_set_camera(
-    world_ptr: *mut World,
-    camera: *const NativeCamera,
+pub unsafe extern "C" fn dropbear_frame_arena_alloc(size: i64) -> *mut u8 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::FRAME_ARENA_ALLOC);
+    if size <= 0 {
+        crate::record_error!(
+            "[dropbear_frame_arena_alloc] [ERROR] invalid allocation size: {}",
+            size
+        );
+        return std::ptr::null_mut();
+    }
+    arena::alloc(size as usize)
+}
+
+// ===========================================
+
+/// Toggles FFI call profiling. Counters are cleared on enable, so each profiling session
+/// starts from zero.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_profiling_enable(enabled: i32) -> i32 {
+    profiling::set_enabled(enabled != 0);
+    DropbearNativeError::Success as i32
+}
+
+/// Copies up to `max_entries` per-export stats (hottest first by cumulative time) into
+/// `out_stats`. Returns the number of entries written, or a negative error code. Entry
+/// names point at static storage and never need freeing.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_profiling_snapshot(
+    out_stats: *mut profiling::FfiStats,
+    max_entries: i32,
 ) -> i32 {
-    if world_ptr.is_null() || camera.is_null() {
-        eprintln!("[dropbear_set_camera] [ERROR] Null pointer received");
-        return -1;
+    if out_stats.is_null() || max_entries < 0 {
+        crate::record_error!("[dropbear_profiling_snapshot] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let world = unsafe { &mut *(world_ptr) };
-    let cam_data = unsafe { &*camera };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_stats, max_entries as usize) };
+    profiling::snapshot(out) as i32
+}
 
-    let entity = unsafe { world.find_entity_from_id(cam_data.entity_id as u32) };
+// ===========================================
 
-    match world.query_one_mut::<&mut Camera>(entity) {
-        Ok(cam) => {
-            cam.eye = DVec3::new(
-                cam_data.eye.x as f64,
-                cam_data.eye.y as f64,
-                cam_data.eye.z as f64,
-            );
+/// Queues a local-transform write without touching the world; pair with
+/// [`dropbear_flush_transform_hierarchy`] to propagate parented rigs once per frame.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_set_local_transform_deferred(
+    world_ptr: *const World,
+    entity_id: i64,
+    local: *const NativeTransform,
+) -> i32 {
+    let _profile =
+        profiling::ProfileGuard::begin(profiling::slot::SET_LOCAL_TRANSFORM_DEFERRED);
+    if world_ptr.is_null() || local.is_null() {
+        crate::record_error!(
+            "[dropbear_set_local_transform_deferred] [ERROR] received null pointer"
+        );
+        return DropbearNativeError::NullPointer as i32;
+    }
 
-            cam.target = DVec3::new(
-                cam_data.target.x as f64,
-                cam_data.target.y as f64,
-                cam_data.target.z as f64,
-            );
+    transform_queue::queue(entity_id, unsafe { (*local).to_transform() });
+    DropbearNativeError::Success as i32
+}
 
-            cam.up = DVec3::new(
-                cam_data.up.x as f64,
-                cam_data.up.y as f64,
-                cam_data.up.z as f64,
-            );
+/// Applies every queued local write and propagates each dirty subtree exactly once,
+/// breadth-first from its root, with independent roots computed in parallel. Returns the
+/// number of entities whose world transform was recomputed.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_flush_transform_hierarchy(world_ptr: *const World) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::FLUSH_TRANSFORM_HIERARCHY);
+    if let Some(err) = mutation_guard("dropbear_flush_transform_hierarchy") {
+        return err;
+    }
 
-            cam.aspect = cam_data.aspect;
-            cam.settings.fov_y = cam_data.fov_y;
-            cam.znear = cam_data.znear;
-            cam.zfar = cam_data.zfar;
-            cam.yaw = cam_data.yaw;
-            cam.pitch = cam_data.pitch;
-            cam.settings.speed = cam_data.speed;
-            cam.settings.sensitivity = cam_data.sensitivity;
+    if world_ptr.is_null() {
+        crate::record_error!("[dropbear_flush_transform_hierarchy] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
 
-            0
-        }
-        Err(_) => {
-            eprintln!("[dropbear_set_camera] [ERROR] Unable to query camera component");
-            -2
+    let world = unsafe { &mut *(world_ptr as *mut World) };
+    transform_queue::flush(world)
+}
+
+// ===========================================
+
+/// Drains up to `max_events` edge-triggered input events (key/button transitions with
+/// frame stamps) into `out`, oldest first, writing the count to `out_count`. One call per
+/// frame replaces the previous-frame bookkeeping and double-polling that level-triggered
+/// checks like [`dropbear_is_key_pressed`] force on every script.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_drain_input_events(
+    input_state_ptr: InputStatePtr,
+    out: *mut NativeInputEvent,
+    max_events: i32,
+    out_count: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::DRAIN_INPUT_EVENTS);
+    if input_state_ptr.is_null() || out.is_null() || out_count.is_null() || max_events < 0 {
+        crate::record_error!("[dropbear_drain_input_events] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let input = unsafe { &mut *input_state_ptr };
+    let count = (input.event_queue.len()).min(max_events as usize);
+    for i in 0..count {
+        let event = input.event_queue.pop_front().unwrap();
+        unsafe {
+            *out.add(i) = NativeInputEvent {
+                kind: event.kind,
+                code: event.code,
+                frame: event.frame,
+            };
         }
     }
+
+    unsafe { *out_count = count as i32 };
+    DropbearNativeError::Success as i32
 }
 
+// ===========================================
+
+/// Returns a zero-copy view of a packaged asset's raw bytes: `*out_ptr`/`*out_len` point
+/// straight into an engine-owned buffer loaded once per asset and valid for the rest of
+/// the process. `asset_path` accepts `euca://` references or paths relative to the
+/// `resources` directory, like the rest of the asset pipeline.
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_get_last_mouse_pos(
-    input_state_ptr: InputStatePtr,
-    out_x: *mut f32,
-    out_y: *mut f32,
+pub unsafe extern "C" fn dropbear_pak_get_bytes(
+    asset_ptr: AssetRegistryPtr,
+    asset_path: *const c_char,
+    out_ptr: *mut *const u8,
+    out_len: *mut u64,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_x.is_null() || out_y.is_null() {
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::PAK_GET_BYTES);
+    if asset_ptr.is_null() || asset_path.is_null() || out_ptr.is_null() || out_len.is_null() {
+        crate::record_error!("[dropbear_pak_get_bytes] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let input = unsafe { &*input_state_ptr };
+    let path = match unsafe { CStr::from_ptr(asset_path) }.to_str() {
+        Ok(path) => path,
+        Err(_) => {
+            crate::record_error!("[dropbear_pak_get_bytes] [ERROR] asset path is not valid UTF-8");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
 
-    if let Some(pos) = input.last_mouse_pos {
-        unsafe {
-            *out_x = pos.0 as f32;
-            *out_y = pos.1 as f32;
+    match pak::get_bytes(path) {
+        Ok((ptr, len)) => {
+            unsafe {
+                *out_ptr = ptr;
+                *out_len = len;
+            }
+            DropbearNativeError::Success as i32
         }
-    } else {
-        unsafe {
-            *out_x = 0.0;
-            *out_y = 0.0;
+        Err(e) => {
+            crate::record_error!(
+                "[dropbear_pak_get_bytes] [ERROR] failed to load '{}': {}",
+                path,
+                e
+            );
+            DropbearNativeError::QueryFailed as i32
         }
     }
-
-    0
 }
 
+// ===========================================
+
+/// Queues a whole batch of debug line segments (consecutive point pairs, one packed
+/// 0xAABBGGRR colour per point) into the graphics command stream in one call. The render
+/// path drains everything queued this frame and uploads it as a single buffer write.
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_is_cursor_hidden(
-    input_state_ptr: InputStatePtr,
-    out_hidden: *mut i32,
+pub unsafe extern "C" fn dropbear_queue_debug_lines(
+    queue_ptr: GraphicsPtr,
+    points: *const Vector3D,
+    colors: *const u32,
+    count: i32,
 ) -> i32 {
-    if input_state_ptr.is_null() || out_hidden.is_null() {
-        return -1;
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::QUEUE_DEBUG_LINES);
+    if queue_ptr.is_null() || points.is_null() || colors.is_null() || count < 0 {
+        crate::record_error!("[dropbear_queue_debug_lines] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
     }
 
-    let input = unsafe { &*input_state_ptr };
+    if count % 2 != 0 {
+        crate::record_error!(
+            "[dropbear_queue_debug_lines] [ERROR] point count {} is odd; lines are point pairs",
+            count
+        );
+        return DropbearNativeError::QueryFailed as i32;
+    }
 
-    unsafe { *out_hidden = if input.is_cursor_hidden { 1 } else { 0 } };
+    let graphics = unsafe { &*(queue_ptr as GraphicsPtr) };
+    let points = unsafe { std::slice::from_raw_parts(points, count as usize) };
+    let colors = unsafe { std::slice::from_raw_parts(colors, count as usize) };
 
-    0
+    let batch = DebugLineBatch {
+        points: points.iter().map(|p| [p.x, p.y, p.z]).collect(),
+        colors: colors.to_vec(),
+    };
+
+    if graphics.send(GraphicsCommand::DebugLines(batch)).is_err() {
+        DropbearNativeError::SendError as i32
+    } else {
+        DropbearNativeError::Success as i32
+    }
 }
 
+/// Queues a script-built mesh (trails, ribbons) for this frame: `vertices` holds
+/// `vertex_float_count` floats in the engine's interleaved layout, `indices` holds
+/// `index_count` indices, drawn with the material `material_handle` refers to. One call
+/// submits the whole mesh; the render path uploads it in a single buffer write.
 #[unsafe(no_mangle)]
-pub unsafe extern "C" fn dropbear_set_cursor_hidden(
+pub unsafe extern "C" fn dropbear_queue_dynamic_mesh(
     queue_ptr: GraphicsPtr,
-    input_state_ptr: InputStatePtr,
-    hidden: i32,
+    vertices: *const f32,
+    vertex_float_count: i32,
+    indices: *const u32,
+    index_count: i32,
+    material_handle: u64,
 ) -> i32 {
-    if input_state_ptr.is_null() || queue_ptr.is_null() {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::QUEUE_DYNAMIC_MESH);
+    if queue_ptr.is_null()
+        || vertices.is_null()
+        || indices.is_null()
+        || vertex_float_count < 0
+        || index_count < 0
+    {
+        crate::record_error!("[dropbear_queue_dynamic_mesh] [ERROR] received null pointer");
         return DropbearNativeError::NullPointer as i32;
     }
 
-    let input = unsafe { &mut *(input_state_ptr as InputStatePtr) };
     let graphics = unsafe { &*(queue_ptr as GraphicsPtr) };
-    input.is_cursor_hidden = hidden != 0;
+    let batch = DynamicMeshBatch {
+        vertices: unsafe { std::slice::from_raw_parts(vertices, vertex_float_count as usize) }
+            .to_vec(),
+        indices: unsafe { std::slice::from_raw_parts(indices, index_count as usize) }.to_vec(),
+        material_handle,
+    };
 
-    if graphics
-        .send(GraphicsCommand::WindowCommand(WindowCommand::HideCursor(
-            input.is_cursor_hidden,
-        )))
-        .is_err()
-    {
+    if graphics.send(GraphicsCommand::DynamicMesh(batch)).is_err() {
         DropbearNativeError::SendError as i32
     } else {
         DropbearNativeError::Success as i32
     }
 }
+
+/// O(1) liveness probe for an entity handle: writes 1 to `out_alive` when the handle's
+/// generation still matches the world, 0 once the entity has been despawned. Cheaper
+/// than attempting a component query and checking for failure.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_entity_alive(
+    world_ptr: *const World,
+    entity_handle: i64,
+    out_alive: *mut i32,
+) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::ENTITY_ALIVE);
+    if world_ptr.is_null() || out_alive.is_null() {
+        crate::record_error!("[dropbear_entity_alive] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let world = unsafe { &*world_ptr };
+    unsafe { *out_alive = entity_from_handle(world, entity_handle).is_some() as i32 };
+    DropbearNativeError::Success as i32
+}
+
+// ===========================================
+
+/// Queues a log record for the engine's sinks without blocking the tick: the level check
+/// is a single branch, and accepted records are copied into a channel drained by a
+/// background thread (see [`script_log`]). Levels use the `DROPBEAR_LOG_*` codes.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_log(level: i32, tag: *const c_char, msg: *const c_char) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::LOG);
+    if !(script_log::LOG_TRACE..=script_log::LOG_ERROR).contains(&level) {
+        crate::record_error!("[dropbear_log] [ERROR] invalid log level: {}", level);
+        return DropbearNativeError::QueryFailed as i32;
+    }
+
+    // The filter comes before the null checks and string copies on purpose: a
+    // filtered-out call must cost one branch and nothing else.
+    if !script_log::enabled(level) {
+        return DropbearNativeError::Success as i32;
+    }
+
+    if tag.is_null() || msg.is_null() {
+        crate::record_error!("[dropbear_log] [ERROR] received null pointer");
+        return DropbearNativeError::NullPointer as i32;
+    }
+
+    let tag = match unsafe { CStr::from_ptr(tag) }.to_str() {
+        Ok(s) => s.to_string(),
+        Err(_) => {
+            crate::record_error!("[dropbear_log] [ERROR] invalid UTF-8 in tag");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
+    let msg = match unsafe { CStr::from_ptr(msg) }.to_str() {
+        Ok(s) => s.to_string(),
+        Err(_) => {
+            crate::record_error!("[dropbear_log] [ERROR] invalid UTF-8 in message");
+            return DropbearNativeError::InvalidUTF8 as i32;
+        }
+    };
+
+    script_log::submit(level, tag, msg);
+    DropbearNativeError::Success as i32
+}
+
+/// Sets the minimum level [`dropbear_log`] forwards. Records below it are dropped at
+/// the producer side; the host logger's own filter still applies downstream.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn dropbear_log_set_level(level: i32) -> i32 {
+    let _profile = profiling::ProfileGuard::begin(profiling::slot::LOG_SET_LEVEL);
+    if !(script_log::LOG_TRACE..=script_log::LOG_ERROR).contains(&level) {
+        crate::record_error!("[dropbear_log_set_level] [ERROR] invalid log level: {}", level);
+        return DropbearNativeError::QueryFailed as i32;
+    }
+
+    script_log::set_min_level(level);
+    DropbearNativeError::Success as i32
+}
@@ -0,0 +1,44 @@
+//! A persistent label -> entity index so scripts can resolve labels without an O(n) world scan.
+//!
+//! The index is rebuilt lazily: a lookup that misses (or hits an entity whose label has
+//! changed or that has been despawned) triggers a single full rebuild, after which every
+//! following lookup is a hash probe. Spawning code can also call [`invalidate`] directly
+//! (see [`crate::spawn::push_pending_spawn`]) to drop the index eagerly.
+
+use crate::states::Label;
+use hecs::{Entity, World};
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+use std::collections::HashMap;
+
+static LABEL_INDEX: Lazy<Mutex<HashMap<String, Entity>>> = Lazy::new(|| Mutex::new(HashMap::new()));
+
+/// Drops the cached index, forcing a rebuild on the next lookup.
+pub fn invalidate() {
+    LABEL_INDEX.lock().clear();
+}
+
+/// Resolves a label to its entity, rebuilding the index when the cached entry is stale.
+pub fn lookup(world: &World, label: &str) -> Option<Entity> {
+    let mut index = LABEL_INDEX.lock();
+
+    if let Some(&entity) = index.get(label) {
+        // Validate the hit against the live world, so a despawn/respawn between lookups
+        // never resolves to the wrong entity.
+        if let Ok(current) = world.get::<&Label>(entity) {
+            if current.as_str() == label {
+                return Some(entity);
+            }
+        }
+    }
+
+    rebuild(world, &mut index);
+    index.get(label).copied()
+}
+
+fn rebuild(world: &World, index: &mut HashMap<String, Entity>) {
+    index.clear();
+    for (entity, label) in world.query::<&Label>().iter() {
+        index.insert(label.as_str().to_string(), entity);
+    }
+}
@@ -0,0 +1,76 @@
+//! Cheap error reporting for the native exports.
+//!
+//! Scripts routinely probe for optional components and properties, so export "errors" are
+//! the common case — unconditionally formatting and writing them to stderr (the old
+//! behaviour) cost microseconds per call. Failure paths now go through
+//! [`record_error!`](crate::record_error), which is a single relaxed atomic load when
+//! diagnostics are off. At verbosity 1 the message is formatted into a thread-local that
+//! `dropbear_get_last_error` can read back; at verbosity 2 it is also written to stderr.
+
+use std::cell::RefCell;
+use std::fmt::Write;
+use std::sync::atomic::{AtomicI32, Ordering};
+
+/// 0 = silent (default), 1 = record into the thread-local, 2 = also print to stderr.
+static VERBOSITY: AtomicI32 = AtomicI32::new(0);
+
+thread_local! {
+    static LAST_ERROR: RefCell<String> = const { RefCell::new(String::new()) };
+}
+
+/// The current error verbosity. Hot paths check this before doing any formatting.
+#[inline]
+pub fn verbosity() -> i32 {
+    VERBOSITY.load(Ordering::Relaxed)
+}
+
+/// Sets the error verbosity for every thread.
+pub fn set_verbosity(level: i32) {
+    VERBOSITY.store(level, Ordering::Relaxed);
+}
+
+/// Stores a formatted message as this thread's last error. Only called by
+/// [`record_error!`](crate::record_error) once the verbosity check has passed.
+pub fn record(message: std::fmt::Arguments) {
+    LAST_ERROR.with(|last| {
+        let mut last = last.borrow_mut();
+        last.clear();
+        let _ = last.write_fmt(message);
+
+        if verbosity() >= 2 {
+            eprintln!("{}", last);
+        }
+    });
+}
+
+/// Copies this thread's last error into `buf` (NUL-terminated, truncated to `len`).
+/// Returns the number of bytes copied, excluding the terminator.
+pub fn copy_to(buf: *mut u8, len: i32) -> i32 {
+    if buf.is_null() || len <= 0 {
+        return 0;
+    }
+
+    LAST_ERROR.with(|last| {
+        let last = last.borrow();
+        let bytes = last.as_bytes();
+        let copy_len = std::cmp::min(bytes.len(), (len - 1) as usize);
+        unsafe {
+            std::ptr::copy_nonoverlapping(bytes.as_ptr(), buf, copy_len);
+            *buf.add(copy_len) = 0;
+        }
+        copy_len as i32
+    })
+}
+
+/// Records an export failure without paying for formatting unless diagnostics are enabled.
+///
+/// Drop-in replacement for the `eprintln!` calls that used to live on every failure path
+/// in `exports.rs`; the message format (`[function] [ERROR] ...`) is unchanged.
+#[macro_export]
+macro_rules! record_error {
+    ($($arg:tt)*) => {
+        if $crate::scripting::native::last_error::verbosity() > 0 {
+            $crate::scripting::native::last_error::record(format_args!($($arg)*));
+        }
+    };
+}
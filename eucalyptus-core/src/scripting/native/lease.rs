@@ -0,0 +1,58 @@
+//! Epoch-style read leases over the world for worker threads.
+//!
+//! `dropbear_world_acquire_read` registers a lease handle; while any lease is outstanding
+//! every mutating export refuses to run (returning
+//! [`ReadLeaseHeld`](crate::scripting::native::DropbearNativeError::ReadLeaseHeld)), which
+//! makes the read-only exports safe to call from any thread for the duration of the lease.
+//! Leases are scoped to the current script tick: [`begin_frame`](super::begin_frame)
+//! force-releases anything still outstanding so a leaked lease cannot wedge the world, and
+//! the engine's own systems (which run outside the script tick) are never blocked.
+
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+use std::collections::HashSet;
+use std::sync::atomic::{AtomicI32, AtomicU64, Ordering};
+
+/// Mirror of `OUTSTANDING.len()`, so [`active`] — checked by `mutation_guard` on every
+/// mutating export — stays a single atomic load.
+static READERS: AtomicI32 = AtomicI32::new(0);
+static NEXT_LEASE: AtomicU64 = AtomicU64::new(1);
+
+/// Handles of every lease acquired but not yet released or reclaimed. Tracking them
+/// individually makes [`release`] idempotent per handle: a double release or a handle
+/// already reclaimed at the frame boundary cannot decrement on behalf of a lease some
+/// other thread still holds.
+static OUTSTANDING: Lazy<Mutex<HashSet<u64>>> = Lazy::new(|| Mutex::new(HashSet::new()));
+
+/// Takes out a read lease and returns its handle.
+pub fn acquire() -> u64 {
+    let handle = NEXT_LEASE.fetch_add(1, Ordering::Relaxed);
+    let mut outstanding = OUTSTANDING.lock();
+    outstanding.insert(handle);
+    READERS.store(outstanding.len() as i32, Ordering::Release);
+    handle
+}
+
+/// Releases a lease previously returned by [`acquire`]. Returns `false` when `handle` is
+/// not outstanding (double release, a stale handle, or the frame boundary already
+/// reclaimed it); only the lease that `handle` names is ever released.
+pub fn release(handle: u64) -> bool {
+    let mut outstanding = OUTSTANDING.lock();
+    if !outstanding.remove(&handle) {
+        return false;
+    }
+    READERS.store(outstanding.len() as i32, Ordering::Release);
+    true
+}
+
+/// Whether any read lease is currently outstanding.
+#[inline]
+pub fn active() -> bool {
+    READERS.load(Ordering::Acquire) > 0
+}
+
+/// Reclaims every outstanding lease at the tick boundary.
+pub fn reset() {
+    OUTSTANDING.lock().clear();
+    READERS.store(0, Ordering::Release);
+}
@@ -0,0 +1,63 @@
+//! Zero-copy asset byte access for native scripts.
+//!
+//! Serves raw asset bytes (config blobs, nav meshes, dialogue tables) from the packaged
+//! resources without the JVM round-trip, which copies everything through byte arrays.
+//! Each asset is read from disk exactly once into a leaked, process-lifetime buffer;
+//! every later lookup hands back the same stable pointer, so an 80MB navmesh is paid for
+//! once instead of per consumer. (A memory-mapped region would additionally page lazily,
+//! but the workspace carries no mmap dependency; the leaked buffer gives the same
+//! zero-copy FFI contract.)
+
+use dropbear_engine::utils::relative_path_from_euca;
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+use std::collections::HashMap;
+use std::path::PathBuf;
+
+static CACHE: Lazy<Mutex<HashMap<String, &'static [u8]>>> =
+    Lazy::new(|| Mutex::new(HashMap::new()));
+
+/// Resolves an asset path the same way [`ResolveReference`] does: `euca://` references
+/// and relative paths land in the `resources` directory (next to the project config in
+/// the editor, next to the executable in the runtime); absolute paths pass through.
+///
+/// [`ResolveReference`]: crate::utils::ResolveReference
+fn resolve(asset_path: &str) -> anyhow::Result<PathBuf> {
+    let relative = relative_path_from_euca(asset_path)?;
+
+    let as_path = PathBuf::from(relative);
+    if as_path.is_absolute() {
+        return Ok(as_path);
+    }
+
+    #[cfg(feature = "editor")]
+    {
+        use crate::states::PROJECT;
+
+        let project_path = PROJECT.read().project_path.clone();
+        Ok(project_path.join("resources").join(relative))
+    }
+
+    #[cfg(not(feature = "editor"))]
+    {
+        let current_exe = std::env::current_exe()?;
+        let dir = current_exe
+            .parent()
+            .ok_or_else(|| anyhow::anyhow!("Unable to get path"))?;
+        Ok(dir.join("resources").join(relative))
+    }
+}
+
+/// Returns a stable `(ptr, len)` view of the asset's bytes, loading them on first use.
+/// The view stays valid for the rest of the process.
+pub fn get_bytes(asset_path: &str) -> anyhow::Result<(*const u8, u64)> {
+    let mut cache = CACHE.lock();
+    if let Some(bytes) = cache.get(asset_path) {
+        return Ok((bytes.as_ptr(), bytes.len() as u64));
+    }
+
+    let path = resolve(asset_path)?;
+    let bytes: &'static [u8] = Box::leak(std::fs::read(&path)?.into_boxed_slice());
+    cache.insert(asset_path.to_string(), bytes);
+    Ok((bytes.as_ptr(), bytes.len() as u64))
+}
@@ -0,0 +1,51 @@
+//! Prefab handles for the batched spawn/despawn exports.
+//!
+//! A "prefab" here is a live donor entity addressed by its [`Label`](crate::states::Label):
+//! resolving a name hands back a stable numeric handle, and spawning clones the donor's
+//! renderer and properties at spawn time. Keeping only the name in the registry means the
+//! donor can be respawned or hot-reloaded without invalidating handles scripts hold.
+
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+use std::collections::HashMap;
+
+struct PrefabRegistry {
+    /// Prefab names, indexed by handle.
+    names: Vec<String>,
+    lookup: HashMap<String, u64>,
+    /// Monotonic counter used to give spawned clones unique labels.
+    spawn_counter: u64,
+}
+
+static REGISTRY: Lazy<Mutex<PrefabRegistry>> = Lazy::new(|| {
+    Mutex::new(PrefabRegistry {
+        names: Vec::new(),
+        lookup: HashMap::new(),
+        spawn_counter: 0,
+    })
+});
+
+/// Resolves a prefab name to its handle, registering it on first use. Handles are stable
+/// for the lifetime of the process.
+pub fn resolve(name: &str) -> u64 {
+    let mut registry = REGISTRY.lock();
+    if let Some(&handle) = registry.lookup.get(name) {
+        return handle;
+    }
+    let handle = registry.names.len() as u64;
+    registry.names.push(name.to_string());
+    registry.lookup.insert(name.to_string(), handle);
+    handle
+}
+
+/// The prefab name behind a handle, or [`None`] for a handle that was never issued.
+pub fn name(handle: u64) -> Option<String> {
+    REGISTRY.lock().names.get(handle as usize).cloned()
+}
+
+/// Hands out a unique label for a clone spawned from the named prefab.
+pub fn next_spawn_label(prefab_name: &str) -> String {
+    let mut registry = REGISTRY.lock();
+    registry.spawn_counter += 1;
+    format!("{}#{}", prefab_name, registry.spawn_counter)
+}
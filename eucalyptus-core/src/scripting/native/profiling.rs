@@ -0,0 +1,304 @@
+//! Always-available profiling counters for the native exports.
+//!
+//! When enabled via `dropbear_profiling_enable`, every export records its call count and
+//! cumulative/max wall time into a fixed table of relaxed atomics — cheap enough to leave
+//! on in production builds, and a single relaxed load per call when disabled.
+//! `dropbear_profiling_snapshot` pulls the table sorted by cumulative time so a spiking
+//! frame can be attributed to the exports the scripts are hammering.
+
+use std::ffi::CStr;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::time::Instant;
+
+/// One slot per export, in the same order as [`EXPORT_NAMES`].
+pub mod slot {
+    pub const GET_ENTITY: usize = 0;
+    pub const GET_ENTITIES: usize = 1;
+    pub const GET_WORLD_TRANSFORM: usize = 2;
+    pub const GET_LOCAL_TRANSFORM: usize = 3;
+    pub const GET_TRANSFORMS_BATCH: usize = 4;
+    pub const SET_TRANSFORMS_BATCH: usize = 5;
+    pub const MAP_WORLD_TRANSFORMS: usize = 6;
+    pub const GET_STRING_PROPERTY: usize = 7;
+    pub const GET_STRING_PROPERTY_VIEW: usize = 8;
+    pub const GET_INT_PROPERTY: usize = 9;
+    pub const GET_LONG_PROPERTY: usize = 10;
+    pub const GET_FLOAT_PROPERTY: usize = 11;
+    pub const GET_DOUBLE_PROPERTY: usize = 12;
+    pub const GET_BOOL_PROPERTY: usize = 13;
+    pub const GET_VEC3_PROPERTY: usize = 14;
+    pub const SET_STRING_PROPERTY: usize = 15;
+    pub const SET_INT_PROPERTY: usize = 16;
+    pub const SET_LONG_PROPERTY: usize = 17;
+    pub const SET_FLOAT_PROPERTY: usize = 18;
+    pub const SET_DOUBLE_PROPERTY: usize = 19;
+    pub const SET_BOOL_PROPERTY: usize = 20;
+    pub const SET_VEC3_PROPERTY: usize = 21;
+    pub const QUERY_ENTITIES: usize = 22;
+    pub const GET_FLOAT_PROPERTY_BATCH: usize = 23;
+    pub const GET_INT_PROPERTY_BATCH: usize = 24;
+    pub const GET_LONG_PROPERTY_BATCH: usize = 25;
+    pub const GET_DOUBLE_PROPERTY_BATCH: usize = 26;
+    pub const GET_BOOL_PROPERTY_BATCH: usize = 27;
+    pub const GET_VEC3_PROPERTY_BATCH: usize = 28;
+    pub const WORLD_ACQUIRE_READ: usize = 29;
+    pub const WORLD_RELEASE_READ: usize = 30;
+    pub const PREFAB_RESOLVE: usize = 31;
+    pub const SPAWN_BATCH: usize = 32;
+    pub const DESPAWN_BATCH: usize = 33;
+    pub const CMD_BEGIN: usize = 34;
+    pub const CMD_SET_TRANSFORM: usize = 35;
+    pub const CMD_SET_STRING_PROPERTY: usize = 36;
+    pub const CMD_SET_INT_PROPERTY: usize = 37;
+    pub const CMD_SET_LONG_PROPERTY: usize = 38;
+    pub const CMD_SET_FLOAT_PROPERTY: usize = 39;
+    pub const CMD_SET_DOUBLE_PROPERTY: usize = 40;
+    pub const CMD_SET_BOOL_PROPERTY: usize = 41;
+    pub const CMD_SET_VEC3_PROPERTY: usize = 42;
+    pub const CMD_SUBMIT: usize = 43;
+    pub const RESOLVE_PROPERTY_ID: usize = 44;
+    pub const GET_STRING_PROPERTY_BY_ID: usize = 45;
+    pub const GET_INT_PROPERTY_BY_ID: usize = 46;
+    pub const GET_LONG_PROPERTY_BY_ID: usize = 47;
+    pub const GET_FLOAT_PROPERTY_BY_ID: usize = 48;
+    pub const GET_DOUBLE_PROPERTY_BY_ID: usize = 49;
+    pub const GET_BOOL_PROPERTY_BY_ID: usize = 50;
+    pub const GET_VEC3_PROPERTY_BY_ID: usize = 51;
+    pub const SET_STRING_PROPERTY_BY_ID: usize = 52;
+    pub const SET_INT_PROPERTY_BY_ID: usize = 53;
+    pub const SET_LONG_PROPERTY_BY_ID: usize = 54;
+    pub const SET_FLOAT_PROPERTY_BY_ID: usize = 55;
+    pub const SET_DOUBLE_PROPERTY_BY_ID: usize = 56;
+    pub const SET_BOOL_PROPERTY_BY_ID: usize = 57;
+    pub const SET_VEC3_PROPERTY_BY_ID: usize = 58;
+    pub const PRINT_INPUT_STATE: usize = 59;
+    pub const GET_INPUT_SNAPSHOT: usize = 60;
+    pub const GET_KEY_BITSET: usize = 61;
+    pub const IS_KEY_PRESSED: usize = 62;
+    pub const GET_MOUSE_POSITION: usize = 63;
+    pub const IS_MOUSE_BUTTON_PRESSED: usize = 64;
+    pub const GET_MOUSE_DELTA: usize = 65;
+    pub const IS_CURSOR_LOCKED: usize = 66;
+    pub const SET_CURSOR_LOCKED: usize = 67;
+    pub const GET_CAMERA: usize = 68;
+    pub const GET_ATTACHED_CAMERA: usize = 69;
+    pub const SET_CAMERA: usize = 70;
+    pub const GET_CAMERA_MATRICES: usize = 71;
+    pub const WORLD_TO_SCREEN: usize = 72;
+    pub const SET_CAMERA_FIELDS: usize = 73;
+    pub const GET_LAST_MOUSE_POS: usize = 74;
+    pub const IS_CURSOR_HIDDEN: usize = 75;
+    pub const SET_CURSOR_HIDDEN: usize = 76;
+    pub const GET_LAST_ERROR: usize = 77;
+    pub const SET_ERROR_VERBOSITY: usize = 78;
+    pub const ASSET_LOAD_ASYNC: usize = 79;
+    pub const FUTURE_STATUS: usize = 80;
+    pub const FUTURE_EXCHANGE: usize = 81;
+    pub const FRAME_ARENA_ALLOC: usize = 82;
+    pub const SET_LOCAL_TRANSFORM_DEFERRED: usize = 83;
+    pub const FLUSH_TRANSFORM_HIERARCHY: usize = 84;
+    pub const DRAIN_INPUT_EVENTS: usize = 85;
+    pub const PAK_GET_BYTES: usize = 86;
+    pub const QUEUE_DEBUG_LINES: usize = 87;
+    pub const QUEUE_DYNAMIC_MESH: usize = 88;
+    pub const ENTITY_ALIVE: usize = 89;
+    pub const JOB_SUBMIT: usize = 90;
+    pub const JOB_STATUS: usize = 91;
+    pub const JOB_JOIN: usize = 92;
+    pub const JOB_CANCEL: usize = 93;
+    pub const LOG: usize = 94;
+    pub const LOG_SET_LEVEL: usize = 95;
+}
+
+pub const EXPORT_COUNT: usize = 96;
+
+pub static EXPORT_NAMES: [&CStr; EXPORT_COUNT] = [
+    c"dropbear_get_entity",
+    c"dropbear_get_entities",
+    c"dropbear_get_world_transform",
+    c"dropbear_get_local_transform",
+    c"dropbear_get_transforms_batch",
+    c"dropbear_set_transforms_batch",
+    c"dropbear_map_world_transforms",
+    c"dropbear_get_string_property",
+    c"dropbear_get_string_property_view",
+    c"dropbear_get_int_property",
+    c"dropbear_get_long_property",
+    c"dropbear_get_float_property",
+    c"dropbear_get_double_property",
+    c"dropbear_get_bool_property",
+    c"dropbear_get_vec3_property",
+    c"dropbear_set_string_property",
+    c"dropbear_set_int_property",
+    c"dropbear_set_long_property",
+    c"dropbear_set_float_property",
+    c"dropbear_set_double_property",
+    c"dropbear_set_bool_property",
+    c"dropbear_set_vec3_property",
+    c"dropbear_query_entities",
+    c"dropbear_get_float_property_batch",
+    c"dropbear_get_int_property_batch",
+    c"dropbear_get_long_property_batch",
+    c"dropbear_get_double_property_batch",
+    c"dropbear_get_bool_property_batch",
+    c"dropbear_get_vec3_property_batch",
+    c"dropbear_world_acquire_read",
+    c"dropbear_world_release_read",
+    c"dropbear_prefab_resolve",
+    c"dropbear_spawn_batch",
+    c"dropbear_despawn_batch",
+    c"dropbear_cmd_begin",
+    c"dropbear_cmd_set_transform",
+    c"dropbear_cmd_set_string_property",
+    c"dropbear_cmd_set_int_property",
+    c"dropbear_cmd_set_long_property",
+    c"dropbear_cmd_set_float_property",
+    c"dropbear_cmd_set_double_property",
+    c"dropbear_cmd_set_bool_property",
+    c"dropbear_cmd_set_vec3_property",
+    c"dropbear_cmd_submit",
+    c"dropbear_resolve_property_id",
+    c"dropbear_get_string_property_by_id",
+    c"dropbear_get_int_property_by_id",
+    c"dropbear_get_long_property_by_id",
+    c"dropbear_get_float_property_by_id",
+    c"dropbear_get_double_property_by_id",
+    c"dropbear_get_bool_property_by_id",
+    c"dropbear_get_vec3_property_by_id",
+    c"dropbear_set_string_property_by_id",
+    c"dropbear_set_int_property_by_id",
+    c"dropbear_set_long_property_by_id",
+    c"dropbear_set_float_property_by_id",
+    c"dropbear_set_double_property_by_id",
+    c"dropbear_set_bool_property_by_id",
+    c"dropbear_set_vec3_property_by_id",
+    c"dropbear_print_input_state",
+    c"dropbear_get_input_snapshot",
+    c"dropbear_get_key_bitset",
+    c"dropbear_is_key_pressed",
+    c"dropbear_get_mouse_position",
+    c"dropbear_is_mouse_button_pressed",
+    c"dropbear_get_mouse_delta",
+    c"dropbear_is_cursor_locked",
+    c"dropbear_set_cursor_locked",
+    c"dropbear_get_camera",
+    c"dropbear_get_attached_camera",
+    c"dropbear_set_camera",
+    c"dropbear_get_camera_matrices",
+    c"dropbear_world_to_screen",
+    c"dropbear_set_camera_fields",
+    c"dropbear_get_last_mouse_pos",
+    c"dropbear_is_cursor_hidden",
+    c"dropbear_set_cursor_hidden",
+    c"dropbear_get_last_error",
+    c"dropbear_set_error_verbosity",
+    c"dropbear_asset_load_async",
+    c"dropbear_future_status",
+    c"dropbear_future_exchange",
+    c"dropbear_frame_arena_alloc",
+    c"dropbear_set_local_transform_deferred",
+    c"dropbear_flush_transform_hierarchy",
+    c"dropbear_drain_input_events",
+    c"dropbear_pak_get_bytes",
+    c"dropbear_queue_debug_lines",
+    c"dropbear_queue_dynamic_mesh",
+    c"dropbear_entity_alive",
+    c"dropbear_job_submit",
+    c"dropbear_job_status",
+    c"dropbear_job_join",
+    c"dropbear_job_cancel",
+    c"dropbear_log",
+    c"dropbear_log_set_level",
+];
+
+pub struct ExportStats {
+    pub calls: AtomicU64,
+    pub total_ns: AtomicU64,
+    pub max_ns: AtomicU64,
+}
+
+#[allow(clippy::declare_interior_mutable_const)]
+const ZERO_STATS: ExportStats = ExportStats {
+    calls: AtomicU64::new(0),
+    total_ns: AtomicU64::new(0),
+    max_ns: AtomicU64::new(0),
+};
+
+static STATS: [ExportStats; EXPORT_COUNT] = [ZERO_STATS; EXPORT_COUNT];
+static ENABLED: AtomicBool = AtomicBool::new(false);
+
+/// Toggles profiling. Counters are cleared on every enable so each session starts clean.
+pub fn set_enabled(enabled: bool) {
+    if enabled {
+        for stats in &STATS {
+            stats.calls.store(0, Ordering::Relaxed);
+            stats.total_ns.store(0, Ordering::Relaxed);
+            stats.max_ns.store(0, Ordering::Relaxed);
+        }
+    }
+    ENABLED.store(enabled, Ordering::Relaxed);
+}
+
+/// Scope guard dropped at the end of an export; times the call when profiling is on.
+pub struct ProfileGuard {
+    index: usize,
+    start: Option<Instant>,
+}
+
+impl ProfileGuard {
+    #[inline]
+    pub fn begin(index: usize) -> Self {
+        let start = if ENABLED.load(Ordering::Relaxed) {
+            Some(Instant::now())
+        } else {
+            None
+        };
+        Self { index, start }
+    }
+}
+
+impl Drop for ProfileGuard {
+    fn drop(&mut self) {
+        if let Some(start) = self.start {
+            let ns = start.elapsed().as_nanos() as u64;
+            let stats = &STATS[self.index];
+            stats.calls.fetch_add(1, Ordering::Relaxed);
+            stats.total_ns.fetch_add(ns, Ordering::Relaxed);
+            stats.max_ns.fetch_max(ns, Ordering::Relaxed);
+        }
+    }
+}
+
+/// A snapshot entry; mirrored as `DropbearFfiStats` in dropbear.h.
+#[repr(C)]
+pub struct FfiStats {
+    pub name: *const std::ffi::c_char,
+    pub calls: u64,
+    pub total_ns: u64,
+    pub max_ns: u64,
+}
+
+/// Copies every export with at least one recorded call into `out`, sorted by cumulative
+/// time (hottest first). Returns the number of entries written.
+pub fn snapshot(out: &mut [FfiStats]) -> usize {
+    let mut entries: Vec<(usize, u64)> = STATS
+        .iter()
+        .enumerate()
+        .filter_map(|(i, stats)| {
+            let calls = stats.calls.load(Ordering::Relaxed);
+            (calls > 0).then(|| (i, stats.total_ns.load(Ordering::Relaxed)))
+        })
+        .collect();
+    entries.sort_by(|a, b| b.1.cmp(&a.1));
+
+    let written = entries.len().min(out.len());
+    for (slot_out, &(i, total_ns)) in out.iter_mut().zip(entries.iter().take(written)) {
+        *slot_out = FfiStats {
+            name: EXPORT_NAMES[i].as_ptr(),
+            calls: STATS[i].calls.load(Ordering::Relaxed),
+            total_ns,
+            max_ns: STATS[i].max_ns.load(Ordering::Relaxed),
+        };
+    }
+    written
+}
@@ -0,0 +1,75 @@
+//! Asynchronous logging for native scripts.
+//!
+//! Scripts used to write straight to stdout/stderr — unbuffered syscalls that stall the
+//! tick by whole milliseconds during burst logging, invisible to the engine's logger.
+//! `dropbear_log` instead copies the record into an unbounded MPSC channel and returns;
+//! a lazily spawned background thread drains the channel into the `log` facade, so the
+//! formatting and sink I/O happen off the script thread. (crossbeam's channel is the
+//! workspace's lock-free MPSC; a bounded ring would only add a drop policy we don't
+//! want for logs.)
+//!
+//! The level filter is a single atomic load checked before anything is copied, so debug
+//! logging can stay compiled into release scripts: a filtered-out call costs one branch.
+
+use crossbeam_channel::Sender;
+use once_cell::sync::Lazy;
+use std::sync::atomic::{AtomicI32, Ordering};
+
+/// Level codes, mirroring the `DROPBEAR_LOG_*` defines in dropbear.h and ordered like
+/// [`crate::logging::LogLevel`].
+pub const LOG_TRACE: i32 = 0;
+pub const LOG_DEBUG: i32 = 1;
+pub const LOG_INFO: i32 = 2;
+pub const LOG_WARN: i32 = 3;
+pub const LOG_ERROR: i32 = 4;
+
+/// Minimum level forwarded to the sinks; everything below it is dropped before any
+/// string copy. Defaults to info, matching [`crate::logging::LogLevel::default`].
+static MIN_LEVEL: AtomicI32 = AtomicI32::new(LOG_INFO);
+
+struct Record {
+    level: i32,
+    tag: String,
+    msg: String,
+}
+
+/// The producer side of the log channel. First use spawns the drain thread; the thread
+/// lives for the rest of the process and parks inside `recv` while the channel is empty.
+static CHANNEL: Lazy<Sender<Record>> = Lazy::new(|| {
+    let (sender, receiver) = crossbeam_channel::unbounded::<Record>();
+
+    std::thread::Builder::new()
+        .name("dropbear-script-log".into())
+        .spawn(move || {
+            for record in receiver {
+                let level = match record.level {
+                    LOG_TRACE => log::Level::Trace,
+                    LOG_DEBUG => log::Level::Debug,
+                    LOG_WARN => log::Level::Warn,
+                    LOG_ERROR => log::Level::Error,
+                    _ => log::Level::Info,
+                };
+                let target = format!("script::{}", record.tag);
+                log::log!(target: &target, level, "{}", record.msg);
+            }
+        })
+        .expect("failed to spawn script log drain thread");
+
+    sender
+});
+
+/// The hot-path filter: one relaxed load and a compare.
+#[inline]
+pub fn enabled(level: i32) -> bool {
+    level >= MIN_LEVEL.load(Ordering::Relaxed)
+}
+
+pub fn set_min_level(level: i32) {
+    MIN_LEVEL.store(level, Ordering::Relaxed);
+}
+
+/// Hands a record to the drain thread. Never blocks; the channel is unbounded and the
+/// send only fails if the drain thread has died, in which case the record is dropped.
+pub fn submit(level: i32, tag: String, msg: String) {
+    let _ = CHANNEL.send(Record { level, tag, msg });
+}
@@ -20,6 +20,16 @@ pub type DestroyTagged = unsafe extern "C" fn(tag: *const c_char) -> i32;
 /// CName: `dropbear_destroy_all`
 pub type DestroyAll = unsafe extern "C" fn() -> i32;
 
+/// CName: `dropbear_system_count` (optional)
+///
+/// Number of script systems the library can describe via [`SystemInfo`].
+pub type SystemCount = unsafe extern "C" fn() -> i32;
+/// CName: `dropbear_system_info` (optional)
+///
+/// Fills in the tag and declared read/write masks for the system at `index`.
+pub type SystemInfo =
+    unsafe extern "C" fn(index: i32, out_info: *mut crate::scripting::native::types::NativeSystemInfo) -> i32;
+
 /// CName: `dropbear_get_last_error_message`
 pub type GetLastErrorMessage = unsafe extern "C" fn() -> *const c_char;
 /// CName: `dropbear_set_last_error_message`
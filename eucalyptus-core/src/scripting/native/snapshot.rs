@@ -0,0 +1,60 @@
+//! Engine-owned, frame-stable world transform snapshots for read-mostly scripts.
+//!
+//! Instead of copying ten doubles per entity across the FFI, `dropbear_map_world_transforms`
+//! hands scripts pointers straight into these buffers. The snapshot is built at most once
+//! per frame (on the first map call) and invalidated by [`begin_frame`](super::begin_frame)
+//! at the top of `update_all`, so the pointers stay valid for the rest of the frame.
+
+use crate::scripting::native::types::NativeTransform;
+use dropbear_engine::entity::EntityTransform;
+use hecs::World;
+use once_cell::sync::Lazy;
+use parking_lot::Mutex;
+
+struct WorldTransformSnapshot {
+    ids: Vec<i64>,
+    transforms: Vec<NativeTransform>,
+    valid: bool,
+}
+
+static SNAPSHOT: Lazy<Mutex<WorldTransformSnapshot>> = Lazy::new(|| {
+    Mutex::new(WorldTransformSnapshot {
+        ids: Vec::new(),
+        transforms: Vec::new(),
+        valid: false,
+    })
+});
+
+/// Marks the snapshot stale; the next map call rebuilds it.
+pub fn invalidate() {
+    SNAPSHOT.lock().valid = false;
+}
+
+/// Returns pointers into the snapshot buffers (transforms, parallel entity ids, count),
+/// rebuilding them from the world on the first call of the frame.
+///
+/// The buffers keep their capacity between frames, so a steady entity count means no
+/// allocations after warm-up. The returned pointers are valid until the next `update_all`.
+pub fn map_world_transforms(world: &World) -> (*const NativeTransform, *const i64, i64) {
+    let mut snapshot = SNAPSHOT.lock();
+
+    if !snapshot.valid {
+        snapshot.ids.clear();
+        snapshot.transforms.clear();
+
+        for (entity, transform) in world.query::<&EntityTransform>().iter() {
+            snapshot.ids.push(entity.to_bits().get() as i64);
+            snapshot
+                .transforms
+                .push(NativeTransform::from_transform(transform.world()));
+        }
+
+        snapshot.valid = true;
+    }
+
+    (
+        snapshot.transforms.as_ptr(),
+        snapshot.ids.as_ptr(),
+        snapshot.transforms.len() as i64,
+    )
+}
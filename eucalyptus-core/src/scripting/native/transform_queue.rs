@@ -0,0 +1,134 @@
+//! Deferred local-transform writes with a single hierarchy flush.
+//!
+//! Animating a parented rig through immediate writes recomputes the same spine chain once
+//! per joint per frame. `dropbear_set_local_transform_deferred` only queues the local
+//! transform; `dropbear_flush_transform_hierarchy` applies every queued write and then
+//! propagates each dirty subtree exactly once, top-down in breadth order. The world
+//! transforms of independent roots are computed in parallel over a read-only world (the
+//! same combine math as [`EntityTransformExt::propagate`]) and written back serially.
+
+use crate::hierarchy::{Children, Parent};
+use dropbear_engine::entity::{EntityTransform, Transform};
+use hecs::{Entity, World};
+use parking_lot::Mutex;
+use rayon::iter::{IntoParallelIterator, ParallelIterator};
+use std::collections::HashSet;
+
+static PENDING: Mutex<Vec<(i64, Transform)>> = Mutex::new(Vec::new());
+
+/// Queues a local-transform write; nothing touches the world until [`flush`].
+pub fn queue(entity_id: i64, local: Transform) {
+    PENDING.lock().push((entity_id, local));
+}
+
+/// `parent_world` ⊗ `local`, matching [`EntityTransformExt::propagate`]'s math.
+///
+/// [`EntityTransformExt::propagate`]: crate::hierarchy::EntityTransformExt::propagate
+fn combine(parent_world: &Transform, local: &Transform) -> Transform {
+    Transform {
+        position: parent_world.position
+            + parent_world.rotation * (local.position * parent_world.scale),
+        rotation: parent_world.rotation * local.rotation,
+        scale: parent_world.scale * local.scale,
+    }
+}
+
+/// Walks one dirty subtree top-down, collecting the recomputed world transforms.
+fn propagate_subtree(world: &World, root: Entity) -> Vec<(Entity, Transform)> {
+    let mut results = Vec::new();
+
+    // The root's own world transform comes from its (possibly clean) parent chain.
+    let root_world = match world.get::<&EntityTransform>(root) {
+        Ok(transform) => match world.get::<&Parent>(root) {
+            Ok(parent) => match world.get::<&EntityTransform>(parent.parent()) {
+                Ok(parent_transform) => combine(parent_transform.world(), transform.local()),
+                Err(_) => *transform.local(),
+            },
+            Err(_) => *transform.local(),
+        },
+        Err(_) => return results,
+    };
+    results.push((root, root_world));
+
+    // Breadth-order walk; each entity's world transform derives from the freshly
+    // computed transform of its parent, so every link is visited exactly once.
+    let mut frontier = std::collections::VecDeque::new();
+    frontier.push_back((root, root_world));
+    while let Some((entity, entity_world)) = frontier.pop_front() {
+        if let Ok(children) = world.get::<&Children>(entity) {
+            for &child in children.children() {
+                if let Ok(child_transform) = world.get::<&EntityTransform>(child) {
+                    let child_world = combine(&entity_world, child_transform.local());
+                    results.push((child, child_world));
+                    frontier.push_back((child, child_world));
+                }
+            }
+        }
+    }
+
+    results
+}
+
+/// Applies every queued local write, then propagates each dirty subtree once.
+/// Returns the number of entities whose world transform was recomputed.
+pub fn flush(world: &mut World) -> i32 {
+    let mut pending = std::mem::take(&mut *PENDING.lock());
+    if pending.is_empty() {
+        return 0;
+    }
+
+    // Phase 1: apply the local writes (serial; &mut World).
+    let mut dirty: HashSet<Entity> = HashSet::new();
+    for (entity_id, local) in pending.drain(..) {
+        let Some(entity) = crate::scripting::native::entity_from_handle(world, entity_id) else {
+            continue;
+        };
+        if let Ok(transform) = world.query_one_mut::<&mut EntityTransform>(entity) {
+            *transform.local_mut() = local;
+            dirty.insert(entity);
+        }
+    }
+
+    // Hand the allocation back so steady-state flushing stays allocation-free.
+    *PENDING.lock() = pending;
+
+    // Phase 2: reduce the dirty set to subtree roots — an entity whose ancestor is also
+    // dirty will be recomputed as part of that ancestor's walk.
+    let roots: Vec<Entity> = dirty
+        .iter()
+        .copied()
+        .filter(|&entity| {
+            let mut current = entity;
+            while let Ok(parent) = world.get::<&Parent>(current) {
+                let parent_entity = parent.parent();
+                if dirty.contains(&parent_entity) {
+                    return false;
+                }
+                current = parent_entity;
+            }
+            true
+        })
+        .collect();
+
+    // Phase 3: compute the new world transforms over a read-only world, independent
+    // roots in parallel, then write back serially.
+    let computed: Vec<(Entity, Transform)> = {
+        let world = &*world;
+        roots
+            .into_par_iter()
+            .map(|root| propagate_subtree(world, root))
+            .reduce(Vec::new, |mut acc, mut subtree| {
+                acc.append(&mut subtree);
+                acc
+            })
+    };
+
+    let recomputed = computed.len() as i32;
+    for (entity, world_transform) in computed {
+        if let Ok(transform) = world.query_one_mut::<&mut EntityTransform>(entity) {
+            *transform.world_mut() = world_transform;
+        }
+    }
+
+    recomputed
+}
@@ -1,6 +1,9 @@
+use dropbear_engine::entity::Transform;
+use glam::{DQuat, DVec3};
 use std::ffi::c_char;
 
 #[repr(C)]
+#[derive(Clone, Copy, Default)]
 pub struct NativeTransform {
     pub position_x: f64,
     pub position_y: f64,
@@ -14,13 +17,76 @@ pub struct NativeTransform {
     pub scale_z: f64,
 }
 
+impl NativeTransform {
+    /// Copies an engine [`Transform`] into the FFI representation.
+    pub fn from_transform(transform: &Transform) -> Self {
+        Self {
+            position_x: transform.position.x,
+            position_y: transform.position.y,
+            position_z: transform.position.z,
+            rotation_x: transform.rotation.x,
+            rotation_y: transform.rotation.y,
+            rotation_z: transform.rotation.z,
+            rotation_w: transform.rotation.w,
+            scale_x: transform.scale.x,
+            scale_y: transform.scale.y,
+            scale_z: transform.scale.z,
+        }
+    }
+
+    /// Converts the FFI representation back into an engine [`Transform`].
+    pub fn to_transform(&self) -> Transform {
+        Transform {
+            position: DVec3::new(self.position_x, self.position_y, self.position_z),
+            rotation: DQuat::from_xyzw(
+                self.rotation_x,
+                self.rotation_y,
+                self.rotation_z,
+                self.rotation_w,
+            ),
+            scale: DVec3::new(self.scale_x, self.scale_y, self.scale_z),
+        }
+    }
+}
+
+/// The FFI mirror of [`EntityTransform`](dropbear_engine::entity::EntityTransform),
+/// carrying both the local and world transforms of an entity.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct NativeEntityTransform {
+    pub local: NativeTransform,
+    pub world: NativeTransform,
+}
+
 #[repr(C)]
+#[derive(Clone, Copy, Default)]
 pub struct Vector3D {
     pub x: f32,
     pub y: f32,
     pub z: f32,
 }
 
+/// A single-crossing snapshot of the whole [`InputState`](crate::input::InputState).
+///
+/// Keys are packed as a bitset indexed by the script-side keycode ordinal
+/// (see [`keycode_from_ordinal`](crate::utils::keycode_from_ordinal)); mouse buttons as a
+/// mask with bit 0 = left, 1 = right, 2 = middle, 3 = back, 4 = forward.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct NativeInputSnapshot {
+    pub key_bitset: [u64; 4],
+    pub mouse_x: f32,
+    pub mouse_y: f32,
+    pub last_mouse_x: f32,
+    pub last_mouse_y: f32,
+    pub mouse_delta_x: f32,
+    pub mouse_delta_y: f32,
+    pub mouse_button_mask: u32,
+    pub is_cursor_locked: i32,
+    pub is_cursor_hidden: i32,
+    pub has_last_mouse_pos: i32,
+}
+
 #[repr(C)]
 pub struct NativeCamera {
     pub label: *const c_char,
@@ -37,3 +103,25 @@ pub struct NativeCamera {
     pub speed: f64,
     pub sensitivity: f64,
 }
+
+/// One edge-triggered input transition. `kind` is one of the
+/// `DROPBEAR_INPUT_EVENT_*` values; `code` is a keycode ordinal for key events or a
+/// mouse button index for button events; `frame` is the script tick the event
+/// arrived on.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct NativeInputEvent {
+    pub kind: i32,
+    pub code: i32,
+    pub frame: u64,
+}
+
+/// Metadata one script system declares through the optional `dropbear_system_info`
+/// library export: its `dropbear_update_tagged` tag plus opaque read/write bitmasks.
+/// Two systems conflict when one's writes overlap the other's reads or writes.
+#[repr(C)]
+pub struct NativeSystemInfo {
+    pub tag: *const c_char,
+    pub reads: u64,
+    pub writes: u64,
+}
@@ -37,5 +37,8 @@ pub trait PendingSpawnController {
 /// Helper function to spawn a [`PendingSpawn`]
 pub fn push_pending_spawn(spawn: PendingSpawn) {
     log::debug!("Pushing spawn");
+    // The scripting label index caches label -> entity mappings; a new spawn means it
+    // has to be rebuilt before the next lookup.
+    crate::scripting::native::label_index::invalidate();
     PENDING_SPAWNS.lock().push(spawn);
 }
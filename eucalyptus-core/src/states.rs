@@ -252,72 +252,360 @@ impl Display for Value {
     }
 }
 
+/// Process-wide property key interner: every distinct key string is stored once and
+/// referenced by a small symbol, so ten thousand entities with a "health" property share
+/// one `String` instead of carrying ten thousand copies.
+static PROPERTY_KEYS: Lazy<RwLock<PropertyKeyInterner>> =
+    Lazy::new(|| RwLock::new(PropertyKeyInterner::default()));
+
+#[derive(Default)]
+struct PropertyKeyInterner {
+    names: Vec<String>,
+    lookup: HashMap<String, u32>,
+}
+
+fn intern_property_key(key: &str) -> u32 {
+    if let Some(&symbol) = PROPERTY_KEYS.read().lookup.get(key) {
+        return symbol;
+    }
+    let mut interner = PROPERTY_KEYS.write();
+    if let Some(&symbol) = interner.lookup.get(key) {
+        return symbol;
+    }
+    let symbol = interner.names.len() as u32;
+    interner.names.push(key.to_string());
+    interner.lookup.insert(key.to_string(), symbol);
+    symbol
+}
+
+fn property_key_name(symbol: u32) -> String {
+    PROPERTY_KEYS.read().names[symbol as usize].clone()
+}
+
+/// Which column a property's value lives in.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum ValueKind {
+    String,
+    Int,
+    Float,
+    Bool,
+    Vec3,
+}
+
+impl ValueKind {
+    fn of(value: &Value) -> Self {
+        match value {
+            Value::String(_) => Self::String,
+            Value::Int(_) => Self::Int,
+            Value::Float(_) => Self::Float,
+            Value::Bool(_) => Self::Bool,
+            Value::Vec3(_) => Self::Vec3,
+        }
+    }
+}
+
+/// One property's bookkeeping: its stable id, interned key and where its value lives.
+#[derive(Debug, Clone, Copy, PartialEq)]
+struct PropertySlot {
+    id: u64,
+    key: u32,
+    kind: ValueKind,
+    row: u32,
+}
+
+/// The serialized face of [`ModelProperties`]: the key/value list the editor and the
+/// scene files have always used. The columnar runtime layout converts through this on
+/// (de)serialization, so .eucs files are unaffected by the restructure.
+#[derive(Serialize, Deserialize, Clone)]
+#[serde(rename = "ModelProperties")]
+struct ModelPropertiesRepr {
+    custom_properties: Vec<Property>,
+    next_id: u64,
+}
+
 /// Properties for an entity, typically queries with `entity.getProperty<Float>` and `entity.setProperty(67)`
+///
+/// Values are stored in typed columns (one contiguous `Vec` per value type) indexed by
+/// small per-slot rows, with keys interned process-wide; typed reads like
+/// [`ModelProperties::get_float`] are an id/kind check plus an array load with no enum
+/// matching, and no key `String` is duplicated per entity.
 #[derive(Debug, Serialize, Deserialize, PartialEq, Clone, SerializableComponent)]
+#[serde(from = "ModelPropertiesRepr", into = "ModelPropertiesRepr")]
 pub struct ModelProperties {
-    pub custom_properties: Vec<Property>,
-    pub next_id: u64,
+    slots: Vec<PropertySlot>,
+    strings: Vec<String>,
+    ints: Vec<i64>,
+    floats: Vec<f64>,
+    bools: Vec<bool>,
+    vec3s: Vec<[f32; 3]>,
+    next_id: u64,
+}
+
+impl From<ModelProperties> for ModelPropertiesRepr {
+    fn from(props: ModelProperties) -> Self {
+        let custom_properties = props
+            .slots
+            .iter()
+            .map(|slot| Property {
+                id: slot.id,
+                key: property_key_name(slot.key),
+                value: props.read_value(slot),
+            })
+            .collect();
+        Self {
+            custom_properties,
+            next_id: props.next_id,
+        }
+    }
+}
+
+impl From<ModelPropertiesRepr> for ModelProperties {
+    fn from(repr: ModelPropertiesRepr) -> Self {
+        let mut props = Self::new();
+        for property in repr.custom_properties {
+            props.insert_slot(property.id, intern_property_key(&property.key), property.value);
+            props.next_id = props.next_id.max(property.id + 1);
+        }
+        props.next_id = props.next_id.max(repr.next_id);
+        props
+    }
 }
 
 impl ModelProperties {
     /// Creates a new [ModelProperties]
     pub fn new() -> Self {
         Self {
-            custom_properties: Vec::new(),
+            slots: Vec::new(),
+            strings: Vec::new(),
+            ints: Vec::new(),
+            floats: Vec::new(),
+            bools: Vec::new(),
+            vec3s: Vec::new(),
             next_id: 0,
         }
     }
 
+    pub fn len(&self) -> usize {
+        self.slots.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.slots.is_empty()
+    }
+
+    /// The `(id, key)` pairs in insertion order, for code (like the inspector) that walks
+    /// all properties.
+    pub fn entries(&self) -> Vec<(u64, String)> {
+        self.slots
+            .iter()
+            .map(|slot| (slot.id, property_key_name(slot.key)))
+            .collect()
+    }
+
+    /// Whether any property uses this key.
+    pub fn has_key(&self, key: &str) -> bool {
+        self.find_slot(key).is_some()
+    }
+
+    fn find_slot(&self, key: &str) -> Option<usize> {
+        let symbol = PROPERTY_KEYS.read().lookup.get(key).copied()?;
+        self.slots.iter().position(|slot| slot.key == symbol)
+    }
+
+    /// Appends `value` to its type's column, returning where it landed.
+    fn push_value(&mut self, value: Value) -> (ValueKind, u32) {
+        match value {
+            Value::String(v) => {
+                self.strings.push(v);
+                (ValueKind::String, (self.strings.len() - 1) as u32)
+            }
+            Value::Int(v) => {
+                self.ints.push(v);
+                (ValueKind::Int, (self.ints.len() - 1) as u32)
+            }
+            Value::Float(v) => {
+                self.floats.push(v);
+                (ValueKind::Float, (self.floats.len() - 1) as u32)
+            }
+            Value::Bool(v) => {
+                self.bools.push(v);
+                (ValueKind::Bool, (self.bools.len() - 1) as u32)
+            }
+            Value::Vec3(v) => {
+                self.vec3s.push(v);
+                (ValueKind::Vec3, (self.vec3s.len() - 1) as u32)
+            }
+        }
+    }
+
+    fn read_value(&self, slot: &PropertySlot) -> Value {
+        let row = slot.row as usize;
+        match slot.kind {
+            ValueKind::String => Value::String(self.strings[row].clone()),
+            ValueKind::Int => Value::Int(self.ints[row]),
+            ValueKind::Float => Value::Float(self.floats[row]),
+            ValueKind::Bool => Value::Bool(self.bools[row]),
+            ValueKind::Vec3 => Value::Vec3(self.vec3s[row]),
+        }
+    }
+
+    /// Swap-removes a column cell and repoints whichever slot owned the moved last row.
+    fn remove_value(&mut self, kind: ValueKind, row: u32) {
+        let last = match kind {
+            ValueKind::String => {
+                self.strings.swap_remove(row as usize);
+                self.strings.len() as u32
+            }
+            ValueKind::Int => {
+                self.ints.swap_remove(row as usize);
+                self.ints.len() as u32
+            }
+            ValueKind::Float => {
+                self.floats.swap_remove(row as usize);
+                self.floats.len() as u32
+            }
+            ValueKind::Bool => {
+                self.bools.swap_remove(row as usize);
+                self.bools.len() as u32
+            }
+            ValueKind::Vec3 => {
+                self.vec3s.swap_remove(row as usize);
+                self.vec3s.len() as u32
+            }
+        };
+        if let Some(moved) = self
+            .slots
+            .iter_mut()
+            .find(|slot| slot.kind == kind && slot.row == last)
+        {
+            moved.row = row;
+        }
+    }
+
+    fn insert_slot(&mut self, id: u64, key: u32, value: Value) {
+        let (kind, row) = self.push_value(value);
+        self.slots.push(PropertySlot { id, key, kind, row });
+    }
+
+    /// Overwrites the slot's value, rehoming it when the value changes type.
+    fn write_slot(&mut self, slot_index: usize, value: Value) {
+        let slot = self.slots[slot_index];
+        if slot.kind == ValueKind::of(&value) {
+            let row = slot.row as usize;
+            match value {
+                Value::String(v) => self.strings[row] = v,
+                Value::Int(v) => self.ints[row] = v,
+                Value::Float(v) => self.floats[row] = v,
+                Value::Bool(v) => self.bools[row] = v,
+                Value::Vec3(v) => self.vec3s[row] = v,
+            }
+        } else {
+            self.remove_value(slot.kind, slot.row);
+            let (kind, row) = self.push_value(value);
+            let slot = &mut self.slots[slot_index];
+            slot.kind = kind;
+            slot.row = row;
+        }
+    }
+
     /// Sets the property based on the [Value] (type) and its key.
     ///
     /// If the value does NOT exist, it will be created.
     /// If the value does exist, it will replace the contents of that item.
     pub fn set_property(&mut self, key: String, value: Value) {
-        if let Some(prop) = self.custom_properties.iter_mut().find(|p| p.key == key) {
-            prop.value = value;
+        if let Some(slot_index) = self.find_slot(&key) {
+            self.write_slot(slot_index, value);
         } else {
-            self.custom_properties.push(Property {
-                id: self.next_id,
-                key,
-                value,
-            });
+            let symbol = intern_property_key(&key);
+            let id = self.next_id;
+            self.insert_slot(id, symbol, value);
             self.next_id += 1;
         }
     }
 
     /// Fetches the property by its key.
-    pub fn get_property(&self, key: &str) -> Option<&Value> {
-        self.custom_properties
-            .iter()
-            .find(|p| p.key == key)
-            .map(|p| &p.value)
+    pub fn get_property(&self, key: &str) -> Option<Value> {
+        let slot_index = self.find_slot(key)?;
+        Some(self.read_value(&self.slots[slot_index]))
+    }
+
+    /// Resolves a key to its stable property id, so repeated accesses can skip the
+    /// string comparison entirely.
+    ///
+    /// The id stays valid for the lifetime of the property on this entity.
+    pub fn resolve_property_id(&self, key: &str) -> Option<u64> {
+        let slot_index = self.find_slot(key)?;
+        Some(self.slots[slot_index].id)
+    }
+
+    /// Fetches the property by its interned id (see [`ModelProperties::resolve_property_id`]).
+    pub fn get_property_by_id(&self, id: u64) -> Option<Value> {
+        let slot = self.slots.iter().find(|slot| slot.id == id)?;
+        Some(self.read_value(slot))
+    }
+
+    /// Replaces the value of the property with the given id.
+    ///
+    /// Unlike [`ModelProperties::set_property`], this never creates a property; it returns
+    /// `false` when the id is unknown.
+    pub fn set_property_by_id(&mut self, id: u64, value: Value) -> bool {
+        if let Some(slot_index) = self.slots.iter().position(|slot| slot.id == id) {
+            self.write_slot(slot_index, value);
+            true
+        } else {
+            false
+        }
+    }
+
+    /// Removes the property with the given id; returns `false` when the id is unknown.
+    pub fn remove_property_by_id(&mut self, id: u64) -> bool {
+        if let Some(slot_index) = self.slots.iter().position(|slot| slot.id == id) {
+            let slot = self.slots.remove(slot_index);
+            self.remove_value(slot.kind, slot.row);
+            true
+        } else {
+            false
+        }
+    }
+
+    /// Renames the property with the given id, keeping its value and id; returns `false`
+    /// when the id is unknown.
+    pub fn rename_property(&mut self, id: u64, new_key: String) -> bool {
+        let symbol = intern_property_key(&new_key);
+        if let Some(slot) = self.slots.iter_mut().find(|slot| slot.id == id) {
+            slot.key = symbol;
+            true
+        } else {
+            false
+        }
     }
 
-    /// Fetches the float property
+    /// Fetches the float property: a kind check and a column load, no enum match.
     pub fn get_float(&self, key: &str) -> Option<f64> {
-        match self.get_property(key)? {
-            Value::Float(f) => Some(*f),
+        let slot = &self.slots[self.find_slot(key)?];
+        match slot.kind {
+            ValueKind::Float => Some(self.floats[slot.row as usize]),
             _ => None,
         }
     }
 
-    /// Fetches the integer property
+    /// Fetches the integer property: a kind check and a column load, no enum match.
     pub fn get_int(&self, key: &str) -> Option<i64> {
-        match self.get_property(key)? {
-            Value::Int(i) => Some(*i),
+        let slot = &self.slots[self.find_slot(key)?];
+        match slot.kind {
+            ValueKind::Int => Some(self.ints[slot.row as usize]),
             _ => None,
         }
     }
 
     /// Creates a new property based on a key and a value.
     ///
-    /// It will push that value again to the property vector.
+    /// Unlike [`ModelProperties::set_property`] this always creates a fresh property,
+    /// even when the key is already in use.
     pub fn add_property(&mut self, key: String, value: Value) {
-        self.custom_properties.push(Property {
-            id: self.next_id,
-            key,
-            value,
-        });
+        let symbol = intern_property_key(&key);
+        let id = self.next_id;
+        self.insert_slot(id, symbol, value);
         self.next_id += 1;
     }
 
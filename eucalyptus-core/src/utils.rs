@@ -40,202 +40,407 @@ pub enum ViewportMode {
     Gizmo,
 }
 
+/// The ordinal -> keycode translation table, baked in at compile time. Index `n` holds the
+/// keycode for script-side ordinal `n`; ordinals outside the table have no keycode.
+pub const KEYCODE_ORDINAL_TABLE: [KeyCode; 194] = [
+    KeyCode::Backquote,
+    KeyCode::Backslash,
+    KeyCode::BracketLeft,
+    KeyCode::BracketRight,
+    KeyCode::Comma,
+    KeyCode::Digit0,
+    KeyCode::Digit1,
+    KeyCode::Digit2,
+    KeyCode::Digit3,
+    KeyCode::Digit4,
+    KeyCode::Digit5,
+    KeyCode::Digit6,
+    KeyCode::Digit7,
+    KeyCode::Digit8,
+    KeyCode::Digit9,
+    KeyCode::Equal,
+    KeyCode::IntlBackslash,
+    KeyCode::IntlRo,
+    KeyCode::IntlYen,
+    KeyCode::KeyA,
+    KeyCode::KeyB,
+    KeyCode::KeyC,
+    KeyCode::KeyD,
+    KeyCode::KeyE,
+    KeyCode::KeyF,
+    KeyCode::KeyG,
+    KeyCode::KeyH,
+    KeyCode::KeyI,
+    KeyCode::KeyJ,
+    KeyCode::KeyK,
+    KeyCode::KeyL,
+    KeyCode::KeyM,
+    KeyCode::KeyN,
+    KeyCode::KeyO,
+    KeyCode::KeyP,
+    KeyCode::KeyQ,
+    KeyCode::KeyR,
+    KeyCode::KeyS,
+    KeyCode::KeyT,
+    KeyCode::KeyU,
+    KeyCode::KeyV,
+    KeyCode::KeyW,
+    KeyCode::KeyX,
+    KeyCode::KeyY,
+    KeyCode::KeyZ,
+    KeyCode::Minus,
+    KeyCode::Period,
+    KeyCode::Quote,
+    KeyCode::Semicolon,
+    KeyCode::Slash,
+    KeyCode::AltLeft,
+    KeyCode::AltRight,
+    KeyCode::Backspace,
+    KeyCode::CapsLock,
+    KeyCode::ContextMenu,
+    KeyCode::ControlLeft,
+    KeyCode::ControlRight,
+    KeyCode::Enter,
+    KeyCode::SuperLeft,
+    KeyCode::SuperRight,
+    KeyCode::ShiftLeft,
+    KeyCode::ShiftRight,
+    KeyCode::Space,
+    KeyCode::Tab,
+    KeyCode::Convert,
+    KeyCode::KanaMode,
+    KeyCode::Lang1,
+    KeyCode::Lang2,
+    KeyCode::Lang3,
+    KeyCode::Lang4,
+    KeyCode::Lang5,
+    KeyCode::NonConvert,
+    KeyCode::Delete,
+    KeyCode::End,
+    KeyCode::Help,
+    KeyCode::Home,
+    KeyCode::Insert,
+    KeyCode::PageDown,
+    KeyCode::PageUp,
+    KeyCode::ArrowDown,
+    KeyCode::ArrowLeft,
+    KeyCode::ArrowRight,
+    KeyCode::ArrowUp,
+    KeyCode::NumLock,
+    KeyCode::Numpad0,
+    KeyCode::Numpad1,
+    KeyCode::Numpad2,
+    KeyCode::Numpad3,
+    KeyCode::Numpad4,
+    KeyCode::Numpad5,
+    KeyCode::Numpad6,
+    KeyCode::Numpad7,
+    KeyCode::Numpad8,
+    KeyCode::Numpad9,
+    KeyCode::NumpadAdd,
+    KeyCode::NumpadBackspace,
+    KeyCode::NumpadClear,
+    KeyCode::NumpadClearEntry,
+    KeyCode::NumpadComma,
+    KeyCode::NumpadDecimal,
+    KeyCode::NumpadDivide,
+    KeyCode::NumpadEnter,
+    KeyCode::NumpadEqual,
+    KeyCode::NumpadHash,
+    KeyCode::NumpadMemoryAdd,
+    KeyCode::NumpadMemoryClear,
+    KeyCode::NumpadMemoryRecall,
+    KeyCode::NumpadMemoryStore,
+    KeyCode::NumpadMemorySubtract,
+    KeyCode::NumpadMultiply,
+    KeyCode::NumpadParenLeft,
+    KeyCode::NumpadParenRight,
+    KeyCode::NumpadStar,
+    KeyCode::NumpadSubtract,
+    KeyCode::Escape,
+    KeyCode::Fn,
+    KeyCode::FnLock,
+    KeyCode::PrintScreen,
+    KeyCode::ScrollLock,
+    KeyCode::Pause,
+    KeyCode::BrowserBack,
+    KeyCode::BrowserFavorites,
+    KeyCode::BrowserForward,
+    KeyCode::BrowserHome,
+    KeyCode::BrowserRefresh,
+    KeyCode::BrowserSearch,
+    KeyCode::BrowserStop,
+    KeyCode::Eject,
+    KeyCode::LaunchApp1,
+    KeyCode::LaunchApp2,
+    KeyCode::LaunchMail,
+    KeyCode::MediaPlayPause,
+    KeyCode::MediaSelect,
+    KeyCode::MediaStop,
+    KeyCode::MediaTrackNext,
+    KeyCode::MediaTrackPrevious,
+    KeyCode::Power,
+    KeyCode::Sleep,
+    KeyCode::AudioVolumeDown,
+    KeyCode::AudioVolumeMute,
+    KeyCode::AudioVolumeUp,
+    KeyCode::WakeUp,
+    KeyCode::Meta,
+    KeyCode::Hyper,
+    KeyCode::Turbo,
+    KeyCode::Abort,
+    KeyCode::Resume,
+    KeyCode::Suspend,
+    KeyCode::Again,
+    KeyCode::Copy,
+    KeyCode::Cut,
+    KeyCode::Find,
+    KeyCode::Open,
+    KeyCode::Paste,
+    KeyCode::Props,
+    KeyCode::Select,
+    KeyCode::Undo,
+    KeyCode::Hiragana,
+    KeyCode::Katakana,
+    KeyCode::F1,
+    KeyCode::F2,
+    KeyCode::F3,
+    KeyCode::F4,
+    KeyCode::F5,
+    KeyCode::F6,
+    KeyCode::F7,
+    KeyCode::F8,
+    KeyCode::F9,
+    KeyCode::F10,
+    KeyCode::F11,
+    KeyCode::F12,
+    KeyCode::F13,
+    KeyCode::F14,
+    KeyCode::F15,
+    KeyCode::F16,
+    KeyCode::F17,
+    KeyCode::F18,
+    KeyCode::F19,
+    KeyCode::F20,
+    KeyCode::F21,
+    KeyCode::F22,
+    KeyCode::F23,
+    KeyCode::F24,
+    KeyCode::F25,
+    KeyCode::F26,
+    KeyCode::F27,
+    KeyCode::F28,
+    KeyCode::F29,
+    KeyCode::F30,
+    KeyCode::F31,
+    KeyCode::F32,
+    KeyCode::F33,
+    KeyCode::F34,
+    KeyCode::F35,
+];
+
 pub fn keycode_from_ordinal(ordinal: i32) -> Option<KeyCode> {
-    match ordinal {
-        0 => Some(KeyCode::Backquote),
-        1 => Some(KeyCode::Backslash),
-        2 => Some(KeyCode::BracketLeft),
-        3 => Some(KeyCode::BracketRight),
-        4 => Some(KeyCode::Comma),
-        5 => Some(KeyCode::Digit0),
-        6 => Some(KeyCode::Digit1),
-        7 => Some(KeyCode::Digit2),
-        8 => Some(KeyCode::Digit3),
-        9 => Some(KeyCode::Digit4),
-        10 => Some(KeyCode::Digit5),
-        11 => Some(KeyCode::Digit6),
-        12 => Some(KeyCode::Digit7),
-        13 => Some(KeyCode::Digit8),
-        14 => Some(KeyCode::Digit9),
-        15 => Some(KeyCode::Equal),
-        16 => Some(KeyCode::IntlBackslash),
-        17 => Some(KeyCode::IntlRo),
-        18 => Some(KeyCode::IntlYen),
-        19 => Some(KeyCode::KeyA),
-        20 => Some(KeyCode::KeyB),
-        21 => Some(KeyCode::KeyC),
-        22 => Some(KeyCode::KeyD),
-        23 => Some(KeyCode::KeyE),
-        24 => Some(KeyCode::KeyF),
-        25 => Some(KeyCode::KeyG),
-        26 => Some(KeyCode::KeyH),
-        27 => Some(KeyCode::KeyI),
-        28 => Some(KeyCode::KeyJ),
-        29 => Some(KeyCode::KeyK),
-        30 => Some(KeyCode::KeyL),
-        31 => Some(KeyCode::KeyM),
-        32 => Some(KeyCode::KeyN),
-        33 => Some(KeyCode::KeyO),
-        34 => Some(KeyCode::KeyP),
-        35 => Some(KeyCode::KeyQ),
-        36 => Some(KeyCode::KeyR),
-        37 => Some(KeyCode::KeyS),
-        38 => Some(KeyCode::KeyT),
-        39 => Some(KeyCode::KeyU),
-        40 => Some(KeyCode::KeyV),
-        41 => Some(KeyCode::KeyW),
-        42 => Some(KeyCode::KeyX),
-        43 => Some(KeyCode::KeyY),
-        44 => Some(KeyCode::KeyZ),
-        45 => Some(KeyCode::Minus),
-        46 => Some(KeyCode::Period),
-        47 => Some(KeyCode::Quote),
-        48 => Some(KeyCode::Semicolon),
-        49 => Some(KeyCode::Slash),
-        50 => Some(KeyCode::AltLeft),
-        51 => Some(KeyCode::AltRight),
-        52 => Some(KeyCode::Backspace),
-        53 => Some(KeyCode::CapsLock),
-        54 => Some(KeyCode::ContextMenu),
-        55 => Some(KeyCode::ControlLeft),
-        56 => Some(KeyCode::ControlRight),
-        57 => Some(KeyCode::Enter),
-        58 => Some(KeyCode::SuperLeft),
-        59 => Some(KeyCode::SuperRight),
-        60 => Some(KeyCode::ShiftLeft),
-        61 => Some(KeyCode::ShiftRight),
-        62 => Some(KeyCode::Space),
-        63 => Some(KeyCode::Tab),
-        64 => Some(KeyCode::Convert),
-        65 => Some(KeyCode::KanaMode),
-        66 => Some(KeyCode::Lang1),
-        67 => Some(KeyCode::Lang2),
-        68 => Some(KeyCode::Lang3),
-        69 => Some(KeyCode::Lang4),
-        70 => Some(KeyCode::Lang5),
-        71 => Some(KeyCode::NonConvert),
-        72 => Some(KeyCode::Delete),
-        73 => Some(KeyCode::End),
-        74 => Some(KeyCode::Help),
-        75 => Some(KeyCode::Home),
-        76 => Some(KeyCode::Insert),
-        77 => Some(KeyCode::PageDown),
-        78 => Some(KeyCode::PageUp),
-        79 => Some(KeyCode::ArrowDown),
-        80 => Some(KeyCode::ArrowLeft),
-        81 => Some(KeyCode::ArrowRight),
-        82 => Some(KeyCode::ArrowUp),
-        83 => Some(KeyCode::NumLock),
-        84 => Some(KeyCode::Numpad0),
-        85 => Some(KeyCode::Numpad1),
-        86 => Some(KeyCode::Numpad2),
-        87 => Some(KeyCode::Numpad3),
-        88 => Some(KeyCode::Numpad4),
-        89 => Some(KeyCode::Numpad5),
-        90 => Some(KeyCode::Numpad6),
-        91 => Some(KeyCode::Numpad7),
-        92 => Some(KeyCode::Numpad8),
-        93 => Some(KeyCode::Numpad9),
-        94 => Some(KeyCode::NumpadAdd),
-        95 => Some(KeyCode::NumpadBackspace),
-        96 => Some(KeyCode::NumpadClear),
-        97 => Some(KeyCode::NumpadClearEntry),
-        98 => Some(KeyCode::NumpadComma),
-        99 => Some(KeyCode::NumpadDecimal),
-        100 => Some(KeyCode::NumpadDivide),
-        101 => Some(KeyCode::NumpadEnter),
-        102 => Some(KeyCode::NumpadEqual),
-        103 => Some(KeyCode::NumpadHash),
-        104 => Some(KeyCode::NumpadMemoryAdd),
-        105 => Some(KeyCode::NumpadMemoryClear),
-        106 => Some(KeyCode::NumpadMemoryRecall),
-        107 => Some(KeyCode::NumpadMemoryStore),
-        108 => Some(KeyCode::NumpadMemorySubtract),
-        109 => Some(KeyCode::NumpadMultiply),
-        110 => Some(KeyCode::NumpadParenLeft),
-        111 => Some(KeyCode::NumpadParenRight),
-        112 => Some(KeyCode::NumpadStar),
-        113 => Some(KeyCode::NumpadSubtract),
-        114 => Some(KeyCode::Escape),
-        115 => Some(KeyCode::Fn),
-        116 => Some(KeyCode::FnLock),
-        117 => Some(KeyCode::PrintScreen),
-        118 => Some(KeyCode::ScrollLock),
-        119 => Some(KeyCode::Pause),
-        120 => Some(KeyCode::BrowserBack),
-        121 => Some(KeyCode::BrowserFavorites),
-        122 => Some(KeyCode::BrowserForward),
-        123 => Some(KeyCode::BrowserHome),
-        124 => Some(KeyCode::BrowserRefresh),
-        125 => Some(KeyCode::BrowserSearch),
-        126 => Some(KeyCode::BrowserStop),
-        127 => Some(KeyCode::Eject),
-        128 => Some(KeyCode::LaunchApp1),
-        129 => Some(KeyCode::LaunchApp2),
-        130 => Some(KeyCode::LaunchMail),
-        131 => Some(KeyCode::MediaPlayPause),
-        132 => Some(KeyCode::MediaSelect),
-        133 => Some(KeyCode::MediaStop),
-        134 => Some(KeyCode::MediaTrackNext),
-        135 => Some(KeyCode::MediaTrackPrevious),
-        136 => Some(KeyCode::Power),
-        137 => Some(KeyCode::Sleep),
-        138 => Some(KeyCode::AudioVolumeDown),
-        139 => Some(KeyCode::AudioVolumeMute),
-        140 => Some(KeyCode::AudioVolumeUp),
-        141 => Some(KeyCode::WakeUp),
-        142 => Some(KeyCode::Meta),
-        143 => Some(KeyCode::Hyper),
-        144 => Some(KeyCode::Turbo),
-        145 => Some(KeyCode::Abort),
-        146 => Some(KeyCode::Resume),
-        147 => Some(KeyCode::Suspend),
-        148 => Some(KeyCode::Again),
-        149 => Some(KeyCode::Copy),
-        150 => Some(KeyCode::Cut),
-        151 => Some(KeyCode::Find),
-        152 => Some(KeyCode::Open),
-        153 => Some(KeyCode::Paste),
-        154 => Some(KeyCode::Props),
-        155 => Some(KeyCode::Select),
-        156 => Some(KeyCode::Undo),
-        157 => Some(KeyCode::Hiragana),
-        158 => Some(KeyCode::Katakana),
-        159 => Some(KeyCode::F1),
-        160 => Some(KeyCode::F2),
-        161 => Some(KeyCode::F3),
-        162 => Some(KeyCode::F4),
-        163 => Some(KeyCode::F5),
-        164 => Some(KeyCode::F6),
-        165 => Some(KeyCode::F7),
-        166 => Some(KeyCode::F8),
-        167 => Some(KeyCode::F9),
-        168 => Some(KeyCode::F10),
-        169 => Some(KeyCode::F11),
-        170 => Some(KeyCode::F12),
-        171 => Some(KeyCode::F13),
-        172 => Some(KeyCode::F14),
-        173 => Some(KeyCode::F15),
-        174 => Some(KeyCode::F16),
-        175 => Some(KeyCode::F17),
-        176 => Some(KeyCode::F18),
-        177 => Some(KeyCode::F19),
-        178 => Some(KeyCode::F20),
-        179 => Some(KeyCode::F21),
-        180 => Some(KeyCode::F22),
-        181 => Some(KeyCode::F23),
-        182 => Some(KeyCode::F24),
-        183 => Some(KeyCode::F25),
-        184 => Some(KeyCode::F26),
-        185 => Some(KeyCode::F27),
-        186 => Some(KeyCode::F28),
-        187 => Some(KeyCode::F29),
-        188 => Some(KeyCode::F30),
-        189 => Some(KeyCode::F31),
-        190 => Some(KeyCode::F32),
-        191 => Some(KeyCode::F33),
-        192 => Some(KeyCode::F34),
-        193 => Some(KeyCode::F35),
+    KEYCODE_ORDINAL_TABLE.get(ordinal as usize).copied()
+}
+
+/// The inverse of [`keycode_from_ordinal`]: maps a winit [`KeyCode`] back to the script-side
+/// ordinal. Returns [`None`] for keycodes that have no ordinal assigned.
+pub fn ordinal_from_keycode(keycode: KeyCode) -> Option<i32> {
+    match keycode {
+        KeyCode::Backquote => Some(0),
+        KeyCode::Backslash => Some(1),
+        KeyCode::BracketLeft => Some(2),
+        KeyCode::BracketRight => Some(3),
+        KeyCode::Comma => Some(4),
+        KeyCode::Digit0 => Some(5),
+        KeyCode::Digit1 => Some(6),
+        KeyCode::Digit2 => Some(7),
+        KeyCode::Digit3 => Some(8),
+        KeyCode::Digit4 => Some(9),
+        KeyCode::Digit5 => Some(10),
+        KeyCode::Digit6 => Some(11),
+        KeyCode::Digit7 => Some(12),
+        KeyCode::Digit8 => Some(13),
+        KeyCode::Digit9 => Some(14),
+        KeyCode::Equal => Some(15),
+        KeyCode::IntlBackslash => Some(16),
+        KeyCode::IntlRo => Some(17),
+        KeyCode::IntlYen => Some(18),
+        KeyCode::KeyA => Some(19),
+        KeyCode::KeyB => Some(20),
+        KeyCode::KeyC => Some(21),
+        KeyCode::KeyD => Some(22),
+        KeyCode::KeyE => Some(23),
+        KeyCode::KeyF => Some(24),
+        KeyCode::KeyG => Some(25),
+        KeyCode::KeyH => Some(26),
+        KeyCode::KeyI => Some(27),
+        KeyCode::KeyJ => Some(28),
+        KeyCode::KeyK => Some(29),
+        KeyCode::KeyL => Some(30),
+        KeyCode::KeyM => Some(31),
+        KeyCode::KeyN => Some(32),
+        KeyCode::KeyO => Some(33),
+        KeyCode::KeyP => Some(34),
+        KeyCode::KeyQ => Some(35),
+        KeyCode::KeyR => Some(36),
+        KeyCode::KeyS => Some(37),
+        KeyCode::KeyT => Some(38),
+        KeyCode::KeyU => Some(39),
+        KeyCode::KeyV => Some(40),
+        KeyCode::KeyW => Some(41),
+        KeyCode::KeyX => Some(42),
+        KeyCode::KeyY => Some(43),
+        KeyCode::KeyZ => Some(44),
+        KeyCode::Minus => Some(45),
+        KeyCode::Period => Some(46),
+        KeyCode::Quote => Some(47),
+        KeyCode::Semicolon => Some(48),
+        KeyCode::Slash => Some(49),
+        KeyCode::AltLeft => Some(50),
+        KeyCode::AltRight => Some(51),
+        KeyCode::Backspace => Some(52),
+        KeyCode::CapsLock => Some(53),
+        KeyCode::ContextMenu => Some(54),
+        KeyCode::ControlLeft => Some(55),
+        KeyCode::ControlRight => Some(56),
+        KeyCode::Enter => Some(57),
+        KeyCode::SuperLeft => Some(58),
+        KeyCode::SuperRight => Some(59),
+        KeyCode::ShiftLeft => Some(60),
+        KeyCode::ShiftRight => Some(61),
+        KeyCode::Space => Some(62),
+        KeyCode::Tab => Some(63),
+        KeyCode::Convert => Some(64),
+        KeyCode::KanaMode => Some(65),
+        KeyCode::Lang1 => Some(66),
+        KeyCode::Lang2 => Some(67),
+        KeyCode::Lang3 => Some(68),
+        KeyCode::Lang4 => Some(69),
+        KeyCode::Lang5 => Some(70),
+        KeyCode::NonConvert => Some(71),
+        KeyCode::Delete => Some(72),
+        KeyCode::End => Some(73),
+        KeyCode::Help => Some(74),
+        KeyCode::Home => Some(75),
+        KeyCode::Insert => Some(76),
+        KeyCode::PageDown => Some(77),
+        KeyCode::PageUp => Some(78),
+        KeyCode::ArrowDown => Some(79),
+        KeyCode::ArrowLeft => Some(80),
+        KeyCode::ArrowRight => Some(81),
+        KeyCode::ArrowUp => Some(82),
+        KeyCode::NumLock => Some(83),
+        KeyCode::Numpad0 => Some(84),
+        KeyCode::Numpad1 => Some(85),
+        KeyCode::Numpad2 => Some(86),
+        KeyCode::Numpad3 => Some(87),
+        KeyCode::Numpad4 => Some(88),
+        KeyCode::Numpad5 => Some(89),
+        KeyCode::Numpad6 => Some(90),
+        KeyCode::Numpad7 => Some(91),
+        KeyCode::Numpad8 => Some(92),
+        KeyCode::Numpad9 => Some(93),
+        KeyCode::NumpadAdd => Some(94),
+        KeyCode::NumpadBackspace => Some(95),
+        KeyCode::NumpadClear => Some(96),
+        KeyCode::NumpadClearEntry => Some(97),
+        KeyCode::NumpadComma => Some(98),
+        KeyCode::NumpadDecimal => Some(99),
+        KeyCode::NumpadDivide => Some(100),
+        KeyCode::NumpadEnter => Some(101),
+        KeyCode::NumpadEqual => Some(102),
+        KeyCode::NumpadHash => Some(103),
+        KeyCode::NumpadMemoryAdd => Some(104),
+        KeyCode::NumpadMemoryClear => Some(105),
+        KeyCode::NumpadMemoryRecall => Some(106),
+        KeyCode::NumpadMemoryStore => Some(107),
+        KeyCode::NumpadMemorySubtract => Some(108),
+        KeyCode::NumpadMultiply => Some(109),
+        KeyCode::NumpadParenLeft => Some(110),
+        KeyCode::NumpadParenRight => Some(111),
+        KeyCode::NumpadStar => Some(112),
+        KeyCode::NumpadSubtract => Some(113),
+        KeyCode::Escape => Some(114),
+        KeyCode::Fn => Some(115),
+        KeyCode::FnLock => Some(116),
+        KeyCode::PrintScreen => Some(117),
+        KeyCode::ScrollLock => Some(118),
+        KeyCode::Pause => Some(119),
+        KeyCode::BrowserBack => Some(120),
+        KeyCode::BrowserFavorites => Some(121),
+        KeyCode::BrowserForward => Some(122),
+        KeyCode::BrowserHome => Some(123),
+        KeyCode::BrowserRefresh => Some(124),
+        KeyCode::BrowserSearch => Some(125),
+        KeyCode::BrowserStop => Some(126),
+        KeyCode::Eject => Some(127),
+        KeyCode::LaunchApp1 => Some(128),
+        KeyCode::LaunchApp2 => Some(129),
+        KeyCode::LaunchMail => Some(130),
+        KeyCode::MediaPlayPause => Some(131),
+        KeyCode::MediaSelect => Some(132),
+        KeyCode::MediaStop => Some(133),
+        KeyCode::MediaTrackNext => Some(134),
+        KeyCode::MediaTrackPrevious => Some(135),
+        KeyCode::Power => Some(136),
+        KeyCode::Sleep => Some(137),
+        KeyCode::AudioVolumeDown => Some(138),
+        KeyCode::AudioVolumeMute => Some(139),
+        KeyCode::AudioVolumeUp => Some(140),
+        KeyCode::WakeUp => Some(141),
+        KeyCode::Meta => Some(142),
+        KeyCode::Hyper => Some(143),
+        KeyCode::Turbo => Some(144),
+        KeyCode::Abort => Some(145),
+        KeyCode::Resume => Some(146),
+        KeyCode::Suspend => Some(147),
+        KeyCode::Again => Some(148),
+        KeyCode::Copy => Some(149),
+        KeyCode::Cut => Some(150),
+        KeyCode::Find => Some(151),
+        KeyCode::Open => Some(152),
+        KeyCode::Paste => Some(153),
+        KeyCode::Props => Some(154),
+        KeyCode::Select => Some(155),
+        KeyCode::Undo => Some(156),
+        KeyCode::Hiragana => Some(157),
+        KeyCode::Katakana => Some(158),
+        KeyCode::F1 => Some(159),
+        KeyCode::F2 => Some(160),
+        KeyCode::F3 => Some(161),
+        KeyCode::F4 => Some(162),
+        KeyCode::F5 => Some(163),
+        KeyCode::F6 => Some(164),
+        KeyCode::F7 => Some(165),
+        KeyCode::F8 => Some(166),
+        KeyCode::F9 => Some(167),
+        KeyCode::F10 => Some(168),
+        KeyCode::F11 => Some(169),
+        KeyCode::F12 => Some(170),
+        KeyCode::F13 => Some(171),
+        KeyCode::F14 => Some(172),
+        KeyCode::F15 => Some(173),
+        KeyCode::F16 => Some(174),
+        KeyCode::F17 => Some(175),
+        KeyCode::F18 => Some(176),
+        KeyCode::F19 => Some(177),
+        KeyCode::F20 => Some(178),
+        KeyCode::F21 => Some(179),
+        KeyCode::F22 => Some(180),
+        KeyCode::F23 => Some(181),
+        KeyCode::F24 => Some(182),
+        KeyCode::F25 => Some(183),
+        KeyCode::F26 => Some(184),
+        KeyCode::F27 => Some(185),
+        KeyCode::F28 => Some(186),
+        KeyCode::F29 => Some(187),
+        KeyCode::F30 => Some(188),
+        KeyCode::F31 => Some(189),
+        KeyCode::F32 => Some(190),
+        KeyCode::F33 => Some(191),
+        KeyCode::F34 => Some(192),
+        KeyCode::F35 => Some(193),
         _ => None,
     }
 }
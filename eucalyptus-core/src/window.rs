@@ -1,6 +1,6 @@
 use crossbeam_channel::{Receiver, Sender, unbounded};
 use once_cell::sync::Lazy;
-use parking_lot::RwLock;
+use parking_lot::{Mutex, RwLock};
 use std::sync::{Arc, OnceLock};
 use winit::window::{CursorGrabMode, Window};
 
@@ -32,6 +32,50 @@ impl CommandCache {
 #[derive(Debug)]
 pub enum GraphicsCommand {
     WindowCommand(WindowCommand),
+    /// A whole batch of debug line segments (consecutive point pairs) for this frame.
+    DebugLines(DebugLineBatch),
+    /// A script-built mesh (trails, ribbons) to draw this frame.
+    DynamicMesh(DynamicMeshBatch),
+}
+
+/// Debug line segments: `points[0]`-`points[1]`, `points[2]`-`points[3]`, ... with one
+/// packed 0xAABBGGRR colour per point.
+#[derive(Debug)]
+pub struct DebugLineBatch {
+    pub points: Vec<[f32; 3]>,
+    pub colors: Vec<u32>,
+}
+
+/// A dynamic mesh in the engine's interleaved vertex layout, indexed, drawn with the
+/// material the handle refers to.
+#[derive(Debug)]
+pub struct DynamicMeshBatch {
+    pub vertices: Vec<f32>,
+    pub indices: Vec<u32>,
+    pub material_handle: u64,
+}
+
+/// Geometry submitted since the last [`drain_geometry`] call, grouped so the renderer
+/// can upload each kind as a single buffer write.
+#[derive(Debug, Default)]
+pub struct FrameGeometry {
+    pub debug_lines: Vec<DebugLineBatch>,
+    pub dynamic_meshes: Vec<DynamicMeshBatch>,
+}
+
+static PENDING_GEOMETRY: Mutex<FrameGeometry> = Mutex::new(FrameGeometry {
+    debug_lines: Vec::new(),
+    dynamic_meshes: Vec::new(),
+});
+
+/// Takes everything queued for this frame, leaving the store empty. The viewport render
+/// drains this once per frame and draws the batches through
+/// `ScriptGeometryRenderer` (one buffer write per kind);
+/// [`begin_frame`](crate::scripting::native::begin_frame) also drains it as a backstop,
+/// so queued geometry is frame-scoped and the store never grows when no render path is
+/// running.
+pub fn drain_geometry() -> FrameGeometry {
+    std::mem::take(&mut *PENDING_GEOMETRY.lock())
 }
 
 #[derive(Debug)]
@@ -77,6 +121,12 @@ pub fn poll(window: Arc<Window>) {
                     }
                 }
             },
+            GraphicsCommand::DebugLines(batch) => {
+                PENDING_GEOMETRY.lock().debug_lines.push(batch);
+            }
+            GraphicsCommand::DynamicMesh(batch) => {
+                PENDING_GEOMETRY.lock().dynamic_meshes.push(batch);
+            }
         }
     }
 }
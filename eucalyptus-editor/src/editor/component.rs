@@ -8,7 +8,7 @@ use dropbear_engine::graphics::NO_TEXTURE;
 use dropbear_engine::lighting::{LightComponent, LightType};
 use dropbear_engine::utils::ResourceReference;
 use egui::{CollapsingHeader, ComboBox, DragValue, Grid, RichText, TextEdit, Ui, UiBuilder};
-use eucalyptus_core::states::{Camera3D, Light, ModelProperties, Property, Script, Value};
+use eucalyptus_core::states::{Camera3D, Light, ModelProperties, Script, Value};
 use eucalyptus_core::camera::CameraType;
 use eucalyptus_core::{fatal, warn};
 use glam::{DVec3, Vec3};
@@ -93,18 +93,22 @@ impl InspectableComponent for ModelProperties {
                     let mut to_delete: Option<u64> = None;
                     let mut to_rename: Option<(u64, String)> = None;
 
-                    for (_i, property) in self.custom_properties.iter_mut().enumerate() {
-                        let mut edited_key = property.key.clone();
+                    for (id, key) in self.entries() {
+                        let mut edited_key = key.clone();
                         ui.add_sized([100.0, 20.0], TextEdit::singleline(&mut edited_key));
 
-                        if edited_key != property.key {
-                            to_rename = Some((property.id, edited_key));
+                        if edited_key != key {
+                            to_rename = Some((id, edited_key));
                         }
 
-                        let current_type = ValueType::from(&mut property.value);
+                        // Materialise the value out of the typed columns, run the
+                        // widgets against it, then write it back through the id.
+                        let mut value = self.get_property_by_id(id).unwrap_or_default();
+
+                        let current_type = ValueType::from(&mut value);
                         let mut selected_type = current_type;
 
-                        ComboBox::from_id_salt(format!("type_{}", property.id))
+                        ComboBox::from_id_salt(format!("type_{}", id))
                             .selected_text(format!("{:?}", selected_type))
                             .show_ui(ui, |ui| {
                                 ui.selectable_value(
@@ -119,7 +123,7 @@ impl InspectableComponent for ModelProperties {
                             });
 
                         if selected_type != current_type {
-                            property.value = match selected_type {
+                            value = match selected_type {
                                 ValueType::String => Value::String(String::new()),
                                 ValueType::Float => Value::Float(0.0),
                                 ValueType::Int => Value::Int(0),
@@ -141,7 +145,7 @@ impl InspectableComponent for ModelProperties {
                             }
                         };
 
-                        match &mut property.value {
+                        match &mut value {
                             Value::String(s) => {
                                 ui.add_sized([100.0, 20.0], egui::TextEdit::singleline(s));
                             }
@@ -165,24 +169,22 @@ impl InspectableComponent for ModelProperties {
                             }
                         }
 
+                        self.set_property_by_id(id, value);
+
                         if ui.button("🗑️").clicked() {
-                            log::debug!("Trashing {}", property.key);
-                            to_delete = Some(property.id);
+                            log::debug!("Trashing {}", key);
+                            to_delete = Some(id);
                         }
 
                         ui.end_row();
                     }
 
                     if let Some(id) = to_delete {
-                        self.custom_properties.retain(|p| p.id != id);
+                        self.remove_property_by_id(id);
                     }
 
                     if let Some((id, new_key)) = to_rename {
-                        if let Some(property) =
-                            self.custom_properties.iter_mut().find(|p| p.id == id)
-                        {
-                            property.key = new_key;
-                        } else {
+                        if !self.rename_property(id, new_key) {
                             warn!("Failed to rename property: id not found");
                         }
                     }
@@ -191,16 +193,11 @@ impl InspectableComponent for ModelProperties {
                         log::debug!("Inserting new default value");
                         let mut new_key = String::from("new_property");
                         let mut counter = 1;
-                        while self.custom_properties.iter().any(|p| p.key == new_key) {
+                        while self.has_key(&new_key) {
                             new_key = format!("new_property_{}", counter);
                             counter += 1;
                         }
-                        self.custom_properties.push(Property {
-                            id: self.next_id,
-                            key: new_key,
-                            value: Value::default(),
-                        });
-                        self.next_id += 1;
+                        self.add_property(new_key, Value::default());
                     }
                 });
             });
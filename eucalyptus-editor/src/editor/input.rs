@@ -14,6 +14,8 @@ use winit::{
 
 impl Keyboard for Editor {
     fn key_down(&mut self, key: KeyCode, _event_loop: &ActiveEventLoop) {
+        self.input_state.push_key_event(key, true);
+
         #[cfg(not(target_os = "macos"))]
         let ctrl_pressed = self
             .input_state
@@ -269,6 +271,7 @@ impl Keyboard for Editor {
     }
 
     fn key_up(&mut self, key: KeyCode, _event_loop: &ActiveEventLoop) {
+        self.input_state.push_key_event(key, false);
         self.input_state.pressed_keys.remove(&key);
     }
 }
@@ -335,10 +338,12 @@ impl Mouse for Editor {
     }
 
     fn mouse_down(&mut self, button: MouseButton) {
+        self.input_state.push_mouse_button_event(button, true);
         self.input_state.mouse_button.insert(button);
     }
 
     fn mouse_up(&mut self, button: MouseButton) {
+        self.input_state.push_mouse_button_event(button, false);
         self.input_state.mouse_button.remove(&button);
     }
 }
@@ -19,7 +19,7 @@ use dropbear_engine::{
     camera::Camera,
     entity::{MeshRenderer, Transform},
     future::FutureHandle,
-    graphics::{RenderContext, SharedGraphicsContext},
+    graphics::{RenderContext, ScriptGeometryRenderer, SharedGraphicsContext},
     lighting::LightManager,
     model::{MODEL_CACHE, ModelId},
     scene::SceneCommand,
@@ -74,6 +74,7 @@ pub struct Editor {
     pub size: Extent3d,
     pub render_pipeline: Option<RenderPipeline>,
     pub outline_pipeline: Option<OutlineShader>,
+    pub script_geometry: Option<ScriptGeometryRenderer>,
     pub light_manager: LightManager,
     pub color: Color,
 
@@ -296,6 +297,7 @@ impl Editor {
             plugin_registry,
             dock_state_shared: None,
             outline_pipeline: None,
+            script_geometry: None,
             open_new_scene_window: false,
             new_scene_name: String::new(),
             current_scene_name: None,
@@ -677,6 +679,7 @@ impl Editor {
 
         self.render_pipeline = None;
         self.outline_pipeline = None;
+        self.script_geometry = None;
         self.texture_id = None;
         self.light_manager = LightManager::new();
 
@@ -1374,6 +1377,11 @@ impl Editor {
                     let outline_shader =
                         OutlineShader::init(graphics.shared.clone(), camera.layout());
                     self.outline_pipeline = Some(outline_shader);
+
+                    self.script_geometry = Some(ScriptGeometryRenderer::new(
+                        graphics.shared.clone(),
+                        camera.layout(),
+                    ));
                 } else {
                     log_once::warn_once!(
                         "Unable to fetch the query result of camera: {:?}",
@@ -2,7 +2,7 @@ use super::*;
 use crate::signal::SignalController;
 use crate::spawn::PendingSpawnController;
 use dropbear_engine::asset::{ASSET_REGISTRY, PointerKind};
-use dropbear_engine::graphics::{InstanceRaw, RenderContext};
+use dropbear_engine::graphics::{InstanceRaw, RenderContext, ScriptGeometryVertex};
 use dropbear_engine::model::MODEL_CACHE;
 use dropbear_engine::{
     entity::{EntityTransform, MeshRenderer, Transform},
@@ -13,7 +13,7 @@ use dropbear_engine::{
 use eucalyptus_core::logging;
 use eucalyptus_core::states::{Label, WorldLoadingStatus};
 use eucalyptus_core::hierarchy::{EntityTransformExt};
-use eucalyptus_core::window::poll;
+use eucalyptus_core::window::{drain_geometry, poll};
 use log;
 use parking_lot::Mutex;
 use tokio::sync::mpsc::unbounded_channel;
@@ -170,6 +170,9 @@ impl Scene for Editor {
         let cache_mutex_ptr = std::sync::LazyLock::force(&MODEL_CACHE) as *const _;
         ASSET_REGISTRY.add_pointer(PointerKind::Const("model_cache"), cache_mutex_ptr as usize);
 
+        let future_queue_ptr = std::sync::Arc::as_ptr(&graphics.shared.future_queue);
+        ASSET_REGISTRY.add_pointer(PointerKind::Const("future_queue"), future_queue_ptr as usize);
+
         if let Some((_, tab)) = self.dock_state.find_active_focused() {
             self.is_viewport_focused = matches!(tab, EditorTab::Viewport);
         } else {
@@ -460,6 +463,49 @@ impl Scene for Editor {
                             }
                         }
                     }
+
+                    // Script-queued geometry: drained here so the batches submitted
+                    // during this tick are drawn before begin_frame discards them.
+                    let geometry = drain_geometry();
+                    if let Some(renderer) = &self.script_geometry {
+                        let mut line_vertices = Vec::new();
+                        for batch in &geometry.debug_lines {
+                            for (point, color) in batch.points.iter().zip(batch.colors.iter()) {
+                                line_vertices.push(ScriptGeometryVertex {
+                                    position: *point,
+                                    color: *color,
+                                });
+                            }
+                        }
+
+                        // ModelVertex layout: 8 floats per vertex. Batches are combined
+                        // into one array with their indices rebased, so the upload stays
+                        // a single buffer write per kind.
+                        const FLOATS_PER_VERTEX: usize = 8;
+                        let mut mesh_vertex_floats: Vec<f32> = Vec::new();
+                        let mut mesh_indices: Vec<u32> = Vec::new();
+                        for batch in &geometry.dynamic_meshes {
+                            if batch.vertices.len() % FLOATS_PER_VERTEX != 0 {
+                                log_once::warn_once!(
+                                    "Dynamic mesh batch has {} floats, not a multiple of {}; skipping",
+                                    batch.vertices.len(),
+                                    FLOATS_PER_VERTEX
+                                );
+                                continue;
+                            }
+                            let base = (mesh_vertex_floats.len() / FLOATS_PER_VERTEX) as u32;
+                            mesh_vertex_floats.extend_from_slice(&batch.vertices);
+                            mesh_indices.extend(batch.indices.iter().map(|index| index + base));
+                        }
+
+                        renderer.render(
+                            graphics,
+                            camera.bind_group(),
+                            &line_vertices,
+                            &mesh_vertex_floats,
+                            &mesh_indices,
+                        );
+                    }
                 } else {
                     log_once::error_once!("Camera returned None");
                 }
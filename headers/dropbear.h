@@ -78,24 +78,347 @@ typedef struct {
     double sensitivity;
 } NativeCamera;
 
+// A single-crossing snapshot of the whole input state. Keys are packed as a bitset indexed
+// by keycode ordinal (bit `n` of word `n / 64`); mouse buttons as a mask with
+// bit 0 = left, 1 = right, 2 = middle, 3 = back, 4 = forward.
+typedef struct {
+    uint64_t key_bitset[4];
+    float mouse_x;
+    float mouse_y;
+    float last_mouse_x;
+    float last_mouse_y;
+    float mouse_delta_x;
+    float mouse_delta_y;
+    uint32_t mouse_button_mask;
+    int32_t is_cursor_locked;
+    int32_t is_cursor_hidden;
+    int32_t has_last_mouse_pos;
+} NativeInputSnapshot;
+
+// ===========================================
+
+// Edge-triggered input events. Kinds for NativeInputEvent.kind; codes are keycode
+// ordinals for key events and mouse button indices (0 = left, 1 = right, 2 = middle,
+// 3 = back, 4 = forward, 5+ = other) for button events.
+#define DROPBEAR_INPUT_EVENT_KEY_DOWN 0
+#define DROPBEAR_INPUT_EVENT_KEY_UP 1
+#define DROPBEAR_INPUT_EVENT_MOUSE_DOWN 2
+#define DROPBEAR_INPUT_EVENT_MOUSE_UP 3
+// Reserved: wheel events are not routed through the input manager yet.
+#define DROPBEAR_INPUT_EVENT_SCROLL 4
+
+typedef struct {
+    int32_t kind;
+    int32_t code;
+    uint64_t frame; // script tick the event arrived on
+} NativeInputEvent;
+
+// Drains up to max_events queued key/button transitions into out, oldest first, and
+// writes the count to out_count. One call per frame replaces the previous-frame
+// bookkeeping that level-triggered polling forces on every script. Undrained events
+// persist (bounded; oldest dropped on overflow).
+int dropbear_drain_input_events(InputState* input_state_ptr, NativeInputEvent* out, int max_events, int* out_count);
+
+// Returns a zero-copy view of a packaged asset's raw bytes: *out_ptr/*out_len point into
+// an engine-owned buffer loaded once per asset and valid for the rest of the process.
+// asset_path accepts euca:// references or paths relative to the resources directory.
+int dropbear_pak_get_bytes(AssetRegistry* registry, const char* asset_path, const uint8_t** out_ptr, uint64_t* out_len);
+
+// Batched geometry submission. dropbear_queue_debug_lines takes consecutive point pairs
+// with one packed 0xAABBGGRR colour per point (count must be even);
+// dropbear_queue_dynamic_mesh takes vertex_float_count floats in the engine's
+// interleaved vertex layout plus index_count indices and a material handle. Each call
+// appends one whole batch to the graphics command stream; the viewport render drains
+// the frame's batches and uploads them in one buffer write per kind. Batches are
+// frame-scoped (anything undrawn is discarded at the next tick boundary), so submit
+// every frame the geometry should be visible. material_handle is carried through but
+// not yet resolved: until a material registry exists, dynamic meshes draw with a
+// neutral flat-shaded material.
+int dropbear_queue_debug_lines(GraphicsCommandQueue* graphics, const Vector3D* points, const uint32_t* colors, int count);
+int dropbear_queue_dynamic_mesh(GraphicsCommandQueue* graphics, const float* vertices, int vertex_float_count, const uint32_t* indices, int index_count, uint64_t material_handle);
+
+// Entity handles are hecs bits: slot index in the low 32 bits, generation in the high
+// 32. Every entry point validates the generation in O(1), so a handle held across a
+// despawn fails with a negative error code (-5, NoSuchEntity) instead of aliasing whatever entity
+// reuses the slot. Handles with a zero generation half (bare indices from older
+// scripts) still resolve by index alone. dropbear_entity_alive writes 1/0 without
+// needing a component query.
+int dropbear_entity_alive(World* world, int64_t entity_handle, int* out_alive);
+
+// Generic async jobs on the engine's worker pool, sharing the future queue (and status
+// codes) of dropbear_asset_load_async. The callback runs on a blocking worker thread;
+// it must be safe to run off the script thread, and arg must stay valid and untouched
+// until the job completes, errors, or is cancelled. dropbear_job_join is non-blocking:
+// it returns 0 once the job finished (negative UnknownError if the callback panicked),
+// and QueryFailed (-2) while still pending — poll it once a frame, don't spin.
+// dropbear_job_cancel aborts at the task level only; a callback already executing runs
+// to completion.
+int dropbear_job_submit(AssetRegistry* registry, void (*fn)(void* arg), void* arg, uint64_t* out_handle);
+int dropbear_job_status(AssetRegistry* registry, uint64_t handle, int* out_status);
+int dropbear_job_join(AssetRegistry* registry, uint64_t handle);
+int dropbear_job_cancel(AssetRegistry* registry, uint64_t handle);
+
+// Asynchronous logging into the engine's sinks. Records at or above the current level
+// are copied into a channel and drained by a background thread, so the formatting and
+// sink I/O never run on the tick; records below it cost one branch, so debug logging
+// can stay compiled into release scripts. Levels default to DROPBEAR_LOG_INFO;
+// dropbear_log_set_level moves the filter at runtime.
+#define DROPBEAR_LOG_TRACE 0
+#define DROPBEAR_LOG_DEBUG 1
+#define DROPBEAR_LOG_INFO 2
+#define DROPBEAR_LOG_WARN 3
+#define DROPBEAR_LOG_ERROR 4
+int dropbear_log(int level, const char* tag, const char* msg);
+int dropbear_log_set_level(int level);
+
+// ===========================================
+
+// One row of the FFI profiling table. `name` points at static storage.
+typedef struct {
+    const char* name;
+    uint64_t calls;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} DropbearFfiStats;
+
+// Toggles per-export call profiling (counts, cumulative and max nanoseconds; cheap enough
+// to leave on in production). Counters are cleared on enable.
+int dropbear_profiling_enable(int enabled);
+
+// Copies up to max_entries rows, hottest first by cumulative time. Returns rows written.
+int dropbear_profiling_snapshot(DropbearFfiStats* out_stats, int max_entries);
+
+// Optional system metadata exported by the SCRIPT library (not the engine). When the
+// library exports both
+//     int32_t dropbear_system_count(void);
+//     int dropbear_system_info(int32_t index, NativeSystemInfo* out_info);
+// the engine partitions systems into batches whose declared read/write masks do not
+// conflict (one's writes overlapping another's reads or writes) and ticks each batch
+// concurrently through dropbear_update_tagged, in declared order. The masks are opaque
+// bitmasks; assign one bit per shared data group. Handlers in a shared batch must be
+// callable from worker threads. Without these exports the engine calls the library's
+// serial dropbear_update_all as before.
+typedef struct {
+    const char* tag;
+    uint64_t reads;
+    uint64_t writes;
+} NativeSystemInfo;
+
+// ===========================================
+
+// Single-lookup dispatch table: resolve only dropbear_get_api and receive every export as
+// a function pointer, plus an ABI handshake. Pass DROPBEAR_API_VERSION; a mismatched
+// header/dylib pair returns an error instead of crashing on a missing symbol. New fields
+// are only ever appended, and the version is bumped whenever the layout changes.
+#define DROPBEAR_API_VERSION 10
+
+typedef struct {
+    uint32_t version;
+    int (*dropbear_get_entity)(const char*, const World*, int64_t*);
+    int (*dropbear_get_entities)(const char**, const World*, int64_t*, int);
+    int (*dropbear_get_world_transform)(const World*, int64_t, NativeTransform*);
+    int (*dropbear_get_local_transform)(const World*, int64_t, NativeTransform*);
+    int (*dropbear_get_transforms_batch)(const World*, const int64_t*, NativeEntityTransform*, int);
+    int (*dropbear_set_transforms_batch)(const World*, const int64_t*, const NativeEntityTransform*, int);
+    int (*dropbear_map_world_transforms)(const World*, const NativeTransform**, const int64_t**, int64_t*);
+    int (*dropbear_get_string_property)(const World*, int64_t, const char*, char*, int);
+    int (*dropbear_get_string_property_view)(const World*, int64_t, const char*, const char**, int*);
+    int (*dropbear_get_int_property)(const World*, int64_t, const char*, int*);
+    int (*dropbear_get_long_property)(const World*, int64_t, const char*, int64_t*);
+    int (*dropbear_get_float_property)(const World*, int64_t, const char*, float*);
+    int (*dropbear_get_double_property)(const World*, int64_t, const char*, double*);
+    int (*dropbear_get_bool_property)(const World*, int64_t, const char*, int*);
+    int (*dropbear_get_vec3_property)(const World*, int64_t, const char*, float*, float*, float*);
+    int (*dropbear_set_string_property)(const World*, int64_t, const char*, const char*);
+    int (*dropbear_set_int_property)(const World*, int64_t, const char*, int);
+    int (*dropbear_set_long_property)(const World*, int64_t, const char*, int64_t);
+    int (*dropbear_set_float_property)(const World*, int64_t, const char*, float);
+    int (*dropbear_set_double_property)(const World*, int64_t, const char*, double);
+    int (*dropbear_set_bool_property)(const World*, int64_t, const char*, int);
+    int (*dropbear_set_vec3_property)(const World*, int64_t, const char*, float, float, float);
+    int (*dropbear_query_entities)(const World*, uint32_t, int64_t*, int, int*);
+    int (*dropbear_get_float_property_batch)(const World*, const int64_t*, const char*, float*, int);
+    int (*dropbear_get_int_property_batch)(const World*, const int64_t*, const char*, int*, int);
+    int (*dropbear_get_long_property_batch)(const World*, const int64_t*, const char*, int64_t*, int);
+    int (*dropbear_get_double_property_batch)(const World*, const int64_t*, const char*, double*, int);
+    int (*dropbear_get_bool_property_batch)(const World*, const int64_t*, const char*, int*, int);
+    int (*dropbear_get_vec3_property_batch)(const World*, const int64_t*, const char*, Vector3D*, int);
+    int (*dropbear_world_acquire_read)(const World*, uint64_t*);
+    int (*dropbear_world_release_read)(uint64_t);
+    int (*dropbear_prefab_resolve)(const char*, uint64_t*);
+    int (*dropbear_spawn_batch)(const World*, uint64_t, const NativeTransform*, int, int64_t*);
+    int (*dropbear_despawn_batch)(const World*, const int64_t*, int);
+    int (*dropbear_cmd_begin)(const World*);
+    int (*dropbear_cmd_set_transform)(int64_t, const NativeEntityTransform*);
+    int (*dropbear_cmd_set_string_property)(int64_t, const char*, const char*);
+    int (*dropbear_cmd_set_int_property)(int64_t, const char*, int);
+    int (*dropbear_cmd_set_long_property)(int64_t, const char*, int64_t);
+    int (*dropbear_cmd_set_float_property)(int64_t, const char*, float);
+    int (*dropbear_cmd_set_double_property)(int64_t, const char*, double);
+    int (*dropbear_cmd_set_bool_property)(int64_t, const char*, int);
+    int (*dropbear_cmd_set_vec3_property)(int64_t, const char*, float, float, float);
+    int (*dropbear_cmd_submit)(void);
+    int (*dropbear_resolve_property_id)(const World*, int64_t, const char*, int*);
+    int (*dropbear_get_string_property_by_id)(const World*, int64_t, int, char*, int);
+    int (*dropbear_get_int_property_by_id)(const World*, int64_t, int, int*);
+    int (*dropbear_get_long_property_by_id)(const World*, int64_t, int, int64_t*);
+    int (*dropbear_get_float_property_by_id)(const World*, int64_t, int, float*);
+    int (*dropbear_get_double_property_by_id)(const World*, int64_t, int, double*);
+    int (*dropbear_get_bool_property_by_id)(const World*, int64_t, int, int*);
+    int (*dropbear_get_vec3_property_by_id)(const World*, int64_t, int, float*, float*, float*);
+    int (*dropbear_set_string_property_by_id)(const World*, int64_t, int, const char*);
+    int (*dropbear_set_int_property_by_id)(const World*, int64_t, int, int);
+    int (*dropbear_set_long_property_by_id)(const World*, int64_t, int, int64_t);
+    int (*dropbear_set_float_property_by_id)(const World*, int64_t, int, float);
+    int (*dropbear_set_double_property_by_id)(const World*, int64_t, int, double);
+    int (*dropbear_set_bool_property_by_id)(const World*, int64_t, int, int);
+    int (*dropbear_set_vec3_property_by_id)(const World*, int64_t, int, float, float, float);
+    void (*dropbear_print_input_state)(const InputState*);
+    int (*dropbear_get_input_snapshot)(const InputState*, NativeInputSnapshot*);
+    int (*dropbear_get_key_bitset)(const InputState*, uint64_t*, int);
+    int (*dropbear_is_key_pressed)(const InputState*, int, int*);
+    int (*dropbear_get_mouse_position)(const InputState*, float*, float*);
+    int (*dropbear_is_mouse_button_pressed)(const InputState*, int, int*);
+    int (*dropbear_get_mouse_delta)(const InputState*, float*, float*);
+    int (*dropbear_is_cursor_locked)(const InputState*, int*);
+    int (*dropbear_set_cursor_locked)(const GraphicsCommandQueue*, const InputState*, int);
+    int (*dropbear_get_camera)(const World*, const char*, NativeCamera*);
+    int (*dropbear_get_attached_camera)(const World*, int64_t, NativeCamera*);
+    int (*dropbear_set_camera)(World*, const NativeCamera*);
+    int (*dropbear_get_camera_matrices)(const World*, int64_t, float*, float*, float*);
+    int (*dropbear_world_to_screen)(const World*, int64_t, const Vector3D*, float*, int);
+    int (*dropbear_set_camera_fields)(World*, int64_t, uint32_t, const NativeCamera*);
+    int (*dropbear_get_last_mouse_pos)(const InputState*, float*, float*);
+    int (*dropbear_is_cursor_hidden)(const InputState*, int*);
+    int (*dropbear_set_cursor_hidden)(const GraphicsCommandQueue*, const InputState*, int);
+    int (*dropbear_get_last_error)(char*, int);
+    int (*dropbear_set_error_verbosity)(int);
+    int (*dropbear_asset_load_async)(const AssetRegistry*, const char*, uint64_t*);
+    int (*dropbear_future_status)(const AssetRegistry*, uint64_t, int*);
+    int (*dropbear_future_exchange)(const AssetRegistry*, uint64_t, uint8_t*, int64_t, int64_t*);
+    uint8_t* (*dropbear_frame_arena_alloc)(int64_t);
+    int (*dropbear_profiling_enable)(int);
+    int (*dropbear_profiling_snapshot)(DropbearFfiStats*, int);
+    int (*dropbear_set_local_transform_deferred)(const World*, int64_t, const NativeTransform*);
+    int (*dropbear_flush_transform_hierarchy)(const World*);
+    int (*dropbear_drain_input_events)(InputState*, NativeInputEvent*, int, int*);
+    int (*dropbear_pak_get_bytes)(AssetRegistry*, const char*, const uint8_t**, uint64_t*);
+    int (*dropbear_queue_debug_lines)(GraphicsCommandQueue*, const Vector3D*, const uint32_t*, int);
+    int (*dropbear_queue_dynamic_mesh)(GraphicsCommandQueue*, const float*, int, const uint32_t*, int, uint64_t);
+    int (*dropbear_entity_alive)(World*, int64_t, int*);
+    int (*dropbear_job_submit)(AssetRegistry*, void (*)(void*), void*, uint64_t*);
+    int (*dropbear_job_status)(AssetRegistry*, uint64_t, int*);
+    int (*dropbear_job_join)(AssetRegistry*, uint64_t);
+    int (*dropbear_job_cancel)(AssetRegistry*, uint64_t);
+    int (*dropbear_log)(int, const char*, const char*);
+    int (*dropbear_log_set_level)(int);
+} DropbearApi;
+
+int dropbear_get_api(uint32_t requested_version, DropbearApi* out_api);
+
 // ===========================================
 
 int dropbear_get_entity(const char* label, const World* world_ptr, int64_t* out_entity);
 
-int dropbear_get_transform(
+// Bulk label resolution; resolves `count` labels in one crossing against the engine's
+// label index. Unresolved slots are set to -1. Returns the number of labels resolved,
+// or a negative error code on invalid arguments.
+int dropbear_get_entities(const char** labels, const World* world_ptr, int64_t* out_entities, int count);
+
+// Scalar transform reads. For writes use dropbear_set_transforms_batch or the command
+// buffer below.
+int dropbear_get_world_transform(
     const World* world_ptr,
     int64_t entity_id,
-    NativeEntityTransform* out_transform
+    NativeTransform* out_transform
 );
 
-int dropbear_set_transform(
+int dropbear_get_local_transform(
     const World* world_ptr,
     int64_t entity_id,
-    const NativeEntityTransform transform
+    NativeTransform* out_transform
 );
 
+// Batched transform access. One FFI crossing fetches/stores the transforms of `count` entities.
+// Returns the number of entities written (entities without a transform are skipped), or a
+// negative error code on invalid arguments.
+int dropbear_get_transforms_batch(
+    const World* world_ptr,
+    const int64_t* entity_ids,
+    NativeEntityTransform* out_transforms,
+    int count
+);
+
+int dropbear_set_transforms_batch(
+    const World* world_ptr,
+    const int64_t* entity_ids,
+    const NativeEntityTransform* transforms,
+    int count
+);
+
+// Zero-copy view of every world transform, for read-only systems. The returned pointers
+// reference engine-owned buffers built at most once per frame; they are valid until the
+// next dropbear_update_all tick, after which they must be re-mapped. Do NOT write through
+// or free them.
+int dropbear_map_world_transforms(
+    const World* world_ptr,
+    const NativeTransform** out_transforms,
+    const int64_t** out_entity_ids,
+    int64_t* out_count
+);
+
+// Read leases. While at least one lease is outstanding, every mutating export returns
+// -8 (ReadLeaseHeld) instead of writing, which makes the read-only exports (transform and
+// property getters, dropbear_get_camera, queries, mapped views) safe to call from any
+// thread. Leases are scoped to the current script tick: release them before returning
+// from your update, anything still held is reclaimed at the next tick boundary.
+int dropbear_world_acquire_read(const World* world_ptr, uint64_t* out_lease);
+int dropbear_world_release_read(uint64_t lease);
+
+// Entity lifecycle. A prefab is a live donor entity addressed by its label; spawning
+// clones the donor's renderer and properties under fresh labels ("<name>#<n>").
+// dropbear_prefab_resolve returns a handle that stays valid for the process lifetime.
+int dropbear_prefab_resolve(const char* name, uint64_t* out_handle);
+
+// Spawns `count` clones, one per world transform, writing the new entity ids to out_ids.
+// Returns the number spawned, or a negative error code (e.g. when no donor entity with the
+// prefab's label exists in the world).
+int dropbear_spawn_batch(const World* world_ptr, uint64_t prefab_handle, const NativeTransform* transforms, int count, int64_t* out_ids);
+
+// Despawns the given entities; ids that are no longer alive are skipped. Returns the
+// number despawned, or a negative error code.
+int dropbear_despawn_batch(const World* world_ptr, const int64_t* entity_ids, int count);
+
+// Deferred hierarchy writes. dropbear_set_local_transform_deferred queues a local
+// transform without touching the world; dropbear_flush_transform_hierarchy applies all
+// queued writes and propagates each dirty subtree exactly once, breadth-first, with
+// independent roots computed in parallel. Returns the number of entities whose world
+// transform was recomputed. Animate parented rigs with these instead of per-joint writes.
+int dropbear_set_local_transform_deferred(const World* world_ptr, int64_t entity_id, const NativeTransform* local);
+int dropbear_flush_transform_hierarchy(const World* world_ptr);
+
+// Deferred command buffer. dropbear_cmd_begin opens a recording against a world; the
+// dropbear_cmd_set_* calls append writes without borrowing the world; dropbear_cmd_submit
+// sorts the recorded writes by entity and applies them in a single pass (last write wins
+// per entity/target). Returns the number of writes applied, or a negative error code when
+// no recording is open. The buffer is thread-local.
+int dropbear_cmd_begin(const World* world_ptr);
+int dropbear_cmd_set_transform(int64_t entity_id, const NativeEntityTransform* transform);
+int dropbear_cmd_set_string_property(int64_t entity_id, const char* label, const char* value);
+int dropbear_cmd_set_int_property(int64_t entity_id, const char* label, int value);
+int dropbear_cmd_set_long_property(int64_t entity_id, const char* label, int64_t value);
+int dropbear_cmd_set_float_property(int64_t entity_id, const char* label, float value);
+int dropbear_cmd_set_double_property(int64_t entity_id, const char* label, double value);
+int dropbear_cmd_set_bool_property(int64_t entity_id, const char* label, int value); // value = 0 or 1
+int dropbear_cmd_set_vec3_property(int64_t entity_id, const char* label, float x, float y, float z);
+int dropbear_cmd_submit(void);
+
 // property management
 int dropbear_get_string_property(const World* world_ptr, int64_t entity_handle, const char* label, char* out_value, int out_value_max_length);
+// Zero-copy variant: points out_ptr at engine-owned, NUL-terminated, frame-pinned storage
+// and writes the byte length (excluding the terminator) to out_len. The view is valid until
+// the next dropbear_update_all tick; do NOT write through or free it.
+int dropbear_get_string_property_view(const World* world_ptr, int64_t entity_handle, const char* label, const char** out_ptr, int* out_len);
 int dropbear_get_int_property(const World* world_ptr, int64_t entity_handle, const char* label, int* out_value);
 int dropbear_get_long_property(const World* world_ptr, int64_t entity_handle, const char* label, int64_t* out_value);
 int dropbear_get_float_property(const World* world_ptr, int64_t entity_handle, const char* label, float* out_value);
@@ -111,10 +434,62 @@ int dropbear_set_double_property(const World* world_ptr, int64_t entity_handle,
 int dropbear_set_bool_property(const World* world_ptr, int64_t entity_handle, const char* label, int value); // value = 0 or 1
 int dropbear_set_vec3_property(const World* world_ptr, int64_t entity_handle, const char* label, float x, float y, float z);
 
+// Component bits for dropbear_query_entities' mask.
+#define DROPBEAR_COMPONENT_LABEL            (1u << 0)
+#define DROPBEAR_COMPONENT_ENTITY_TRANSFORM (1u << 1)
+#define DROPBEAR_COMPONENT_MESH_RENDERER    (1u << 2)
+#define DROPBEAR_COMPONENT_CAMERA           (1u << 3)
+#define DROPBEAR_COMPONENT_MODEL_PROPERTIES (1u << 4)
+
+// Fetches every entity that has ALL components in the mask, walking archetypes once
+// instead of N label scans. Writes up to `max` ids into out_ids and the total match count
+// into out_count (compare against max to detect a too-small buffer). Returns the number of
+// ids written, or a negative error code.
+int dropbear_query_entities(const World* world_ptr, uint32_t component_mask, int64_t* out_ids, int max, int* out_count);
+
+// Columnar batch reads: one crossing resolves the label once and fills out[i] for each
+// entity in ids whose property exists and has the matching type; other slots are left
+// untouched. The vec3 variant fills a packed Vector3D array. Returns the number of slots
+// written, or a negative error code on invalid arguments.
+int dropbear_get_float_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, float* out_values, int count);
+int dropbear_get_int_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, int* out_values, int count);
+int dropbear_get_long_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, int64_t* out_values, int count);
+int dropbear_get_double_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, double* out_values, int count);
+int dropbear_get_bool_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, int* out_values, int count); // 0 or 1
+int dropbear_get_vec3_property_batch(const World* world_ptr, const int64_t* entity_ids, const char* label, Vector3D* out_values, int count);
+
+// Interned property IDs. Resolve the label once per entity, then use the `_by_id` variants
+// below on the hot path to skip the per-call string hashing/comparison. The id stays valid
+// for as long as the property exists on the entity.
+int dropbear_resolve_property_id(const World* world_ptr, int64_t entity_handle, const char* label, int32_t* out_id);
+
+int dropbear_get_string_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, char* out_value, int out_value_max_length);
+int dropbear_get_int_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int* out_value);
+int dropbear_get_long_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int64_t* out_value);
+int dropbear_get_float_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, float* out_value);
+int dropbear_get_double_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, double* out_value);
+int dropbear_get_bool_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int* out_value); // out_value = 0 or 1
+int dropbear_get_vec3_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, float* out_x, float* out_y, float* out_z);
+
+int dropbear_set_string_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, const char* value);
+int dropbear_set_int_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int value);
+int dropbear_set_long_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int64_t value);
+int dropbear_set_float_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, float value);
+int dropbear_set_double_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, double value);
+int dropbear_set_bool_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, int value); // value = 0 or 1
+int dropbear_set_vec3_property_by_id(const World* world_ptr, int64_t entity_handle, int32_t property_id, float x, float y, float z);
+
 
 // input stuff
+// Fills a NativeInputSnapshot in one crossing, replacing the per-key/per-axis polling calls
+// below. Note: consumes the pending mouse delta, exactly like dropbear_get_mouse_delta.
+int dropbear_get_input_snapshot(const InputState* input_state_ptr, NativeInputSnapshot* out_snapshot);
 void dropbear_print_input_state(const InputState* input_state_ptr);
 int dropbear_is_key_pressed(const InputState* input_state_ptr, int keycode, int* out_value); // out_value = 0 or 1
+// Packs every key state into a bitset (bit = keycode ordinal, same layout as
+// NativeInputSnapshot.key_bitset) in one call. 4 words cover all ordinals. Returns the
+// number of words written, or a negative error code.
+int dropbear_get_key_bitset(const InputState* input_state_ptr, uint64_t* out_words, int word_count);
 int dropbear_get_mouse_position(const InputState* input_state_ptr, float* out_x, float* out_y);
 int dropbear_is_mouse_button_pressed(const InputState* input_state_ptr, int button_code, int* out_pressed);
 int dropbear_get_mouse_delta(const InputState* input_state_ptr, float* out_delta_x, float* out_delta_y);
@@ -124,11 +499,64 @@ int dropbear_get_last_mouse_pos(const InputState* input_state_ptr, float* out_x,
 int dropbear_is_cursor_hidden(const InputState* input_state_ptr, int* out_hidden);
 int dropbear_set_cursor_hidden(const GraphicsCommandQueue* graphics_ptr, const InputState* input_state_ptr, int hidden);
 
+// async asset loading
+// Handles are ids into the engine's future queue, which is polled once per frame by the app.
+typedef uint64_t FutureHandle;
+
+// Kicks off an asynchronous read of `path` and returns immediately. Poll
+// dropbear_future_status until it reports 2 (completed), then call dropbear_future_exchange.
+int dropbear_asset_load_async(const AssetRegistry* registry, const char* path, FutureHandle* out_handle);
+
+// Status codes: 0 = not polled yet, 1 = running, 2 = completed, 3 = cancelled.
+int dropbear_future_status(const AssetRegistry* registry, FutureHandle handle, int* out_status);
+
+// Writes the total byte count to out_len and copies up to buf_len bytes into out_buf (pass
+// NULL/0 to query the size first — the result stays cached). Returns the number of bytes
+// copied, or a negative error code when the future is not completed or the load failed.
+int dropbear_future_exchange(const AssetRegistry* registry, FutureHandle handle, uint8_t* out_buf, int64_t buf_len, int64_t* out_len);
+
+// frame arena
+// Bump-allocates `size` bytes of scratch valid until the next dropbear_update_all tick.
+// Never free the returned pointer; the arena is rewound wholesale at the tick boundary.
+uint8_t* dropbear_frame_arena_alloc(int64_t size);
+
+// error reporting
+// By default failing exports only return their error code; no message is formatted. Set the
+// verbosity to 1 to have messages recorded per-thread (readable via dropbear_get_last_error),
+// or 2 to additionally print them to stderr. Returns the number of bytes copied into buf.
+int dropbear_get_last_error(char* buf, int len);
+int dropbear_set_error_verbosity(int level);
+
 // camera
 int dropbear_get_camera(const World* world_ptr, const char* label, NativeCamera* out_camera);
 int dropbear_get_attached_camera(const World* world_ptr, int64_t id, NativeCamera* out_camera);
 int dropbear_set_camera(const World* world_ptr, const NativeCamera* camera);
 
+// Copies the engine's cached view/projection matrices for the camera on `entity_id` as
+// column-major float[16] arrays (any output may be NULL to skip it). out_viewproj16 is the
+// wgpu-corrected projection * view the renderer actually uses.
+int dropbear_get_camera_matrices(const World* world_ptr, int64_t entity_id, float* out_view16, float* out_proj16, float* out_viewproj16);
+
+// Projects `count` world-space points through the camera's view-projection in one crossing,
+// writing normalised screen coordinates ((0,0) top-left, (1,1) bottom-right) as x,y pairs
+// into out_xy. Points behind the camera get (-1,-1). Returns the number of points in front
+// of the camera, or a negative error code.
+int dropbear_world_to_screen(const World* world_ptr, int64_t camera_id, const Vector3D* points, float* out_xy, int count);
+
+// Field bits for dropbear_set_camera_fields. PROJECTION covers aspect/fov_y/znear/zfar.
+#define DROPBEAR_CAMERA_EYE         (1u << 0)
+#define DROPBEAR_CAMERA_TARGET      (1u << 1)
+#define DROPBEAR_CAMERA_UP          (1u << 2)
+#define DROPBEAR_CAMERA_PROJECTION  (1u << 3)
+#define DROPBEAR_CAMERA_YAW         (1u << 4)
+#define DROPBEAR_CAMERA_PITCH       (1u << 5)
+#define DROPBEAR_CAMERA_SPEED       (1u << 6)
+#define DROPBEAR_CAMERA_SENSITIVITY (1u << 7)
+
+// Applies only the masked fields of `partial` to the camera on `entity_id`. The label
+// pointer inside the struct is ignored, so partial updates never pay a string round-trip.
+int dropbear_set_camera_fields(const World* world_ptr, int64_t entity_id, uint32_t field_mask, const NativeCamera* partial);
+
 // ===========================================
 
 #ifdef __cplusplus
@@ -0,0 +1,242 @@
+/**
+ * dropbear-engine math companion header. Created as part of the dropbear project.
+ *
+ * Inline SIMD implementations (SSE2 on x86-64, NEON on aarch64, scalar everywhere
+ * else) of the operations that dominate script-side gameplay math: quaternion
+ * multiply, quaternion-rotate-vec3, transform compose and transform interpolate.
+ *
+ * Everything is laid out to match `NativeTransform`'s field order exactly, so you
+ * can pass `&t->position_x`, `&t->rotation_x` and `&t->scale_x` straight into the
+ * array-taking helpers with zero shuffling. Quaternions are (x, y, z, w); the
+ * compose math mirrors the engine's hierarchy propagation
+ * (`EntityTransformExt::propagate`), so composing on the script side and letting
+ * the engine flush produce bit-identical results up to floating-point ordering.
+ *
+ * Header-only; no library to link. Licensed under MIT or Apache 2.0 depending on
+ * your mood.
+ */
+
+#ifndef DROPBEAR_MATH_H
+#define DROPBEAR_MATH_H
+
+#include <math.h>
+
+#include "dropbear.h"
+
+// ===========================================
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DROPBEAR_MATH_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DROPBEAR_MATH_NEON 1
+#include <arm_neon.h>
+#endif
+
+// ===========================================
+
+// Two-lane f64 vector. `NativeTransform` is all doubles, so every operation below
+// is expressed as pairs of lanes plus a scalar tail for the odd third component.
+
+#if defined(DROPBEAR_MATH_SSE2)
+
+typedef __m128d dropbear_f64x2;
+
+static inline dropbear_f64x2 dropbear_f64x2_load(const double* p) { return _mm_loadu_pd(p); }
+static inline void dropbear_f64x2_store(double* p, dropbear_f64x2 a) { _mm_storeu_pd(p, a); }
+static inline dropbear_f64x2 dropbear_f64x2_set(double lane0, double lane1) { return _mm_set_pd(lane1, lane0); }
+static inline dropbear_f64x2 dropbear_f64x2_splat(double v) { return _mm_set1_pd(v); }
+static inline dropbear_f64x2 dropbear_f64x2_add(dropbear_f64x2 a, dropbear_f64x2 b) { return _mm_add_pd(a, b); }
+static inline dropbear_f64x2 dropbear_f64x2_sub(dropbear_f64x2 a, dropbear_f64x2 b) { return _mm_sub_pd(a, b); }
+static inline dropbear_f64x2 dropbear_f64x2_mul(dropbear_f64x2 a, dropbear_f64x2 b) { return _mm_mul_pd(a, b); }
+// acc + a * b
+static inline dropbear_f64x2 dropbear_f64x2_fma(dropbear_f64x2 acc, dropbear_f64x2 a, dropbear_f64x2 b) {
+    return _mm_add_pd(acc, _mm_mul_pd(a, b));
+}
+
+#elif defined(DROPBEAR_MATH_NEON)
+
+typedef float64x2_t dropbear_f64x2;
+
+static inline dropbear_f64x2 dropbear_f64x2_load(const double* p) { return vld1q_f64(p); }
+static inline void dropbear_f64x2_store(double* p, dropbear_f64x2 a) { vst1q_f64(p, a); }
+static inline dropbear_f64x2 dropbear_f64x2_set(double lane0, double lane1) {
+    double lanes[2] = { lane0, lane1 };
+    return vld1q_f64(lanes);
+}
+static inline dropbear_f64x2 dropbear_f64x2_splat(double v) { return vdupq_n_f64(v); }
+static inline dropbear_f64x2 dropbear_f64x2_add(dropbear_f64x2 a, dropbear_f64x2 b) { return vaddq_f64(a, b); }
+static inline dropbear_f64x2 dropbear_f64x2_sub(dropbear_f64x2 a, dropbear_f64x2 b) { return vsubq_f64(a, b); }
+static inline dropbear_f64x2 dropbear_f64x2_mul(dropbear_f64x2 a, dropbear_f64x2 b) { return vmulq_f64(a, b); }
+// acc + a * b
+static inline dropbear_f64x2 dropbear_f64x2_fma(dropbear_f64x2 acc, dropbear_f64x2 a, dropbear_f64x2 b) {
+    return vfmaq_f64(acc, a, b);
+}
+
+#else
+
+typedef struct { double lanes[2]; } dropbear_f64x2;
+
+static inline dropbear_f64x2 dropbear_f64x2_load(const double* p) {
+    dropbear_f64x2 r = { { p[0], p[1] } };
+    return r;
+}
+static inline void dropbear_f64x2_store(double* p, dropbear_f64x2 a) {
+    p[0] = a.lanes[0];
+    p[1] = a.lanes[1];
+}
+static inline dropbear_f64x2 dropbear_f64x2_set(double lane0, double lane1) {
+    dropbear_f64x2 r = { { lane0, lane1 } };
+    return r;
+}
+static inline dropbear_f64x2 dropbear_f64x2_splat(double v) { return dropbear_f64x2_set(v, v); }
+static inline dropbear_f64x2 dropbear_f64x2_add(dropbear_f64x2 a, dropbear_f64x2 b) {
+    return dropbear_f64x2_set(a.lanes[0] + b.lanes[0], a.lanes[1] + b.lanes[1]);
+}
+static inline dropbear_f64x2 dropbear_f64x2_sub(dropbear_f64x2 a, dropbear_f64x2 b) {
+    return dropbear_f64x2_set(a.lanes[0] - b.lanes[0], a.lanes[1] - b.lanes[1]);
+}
+static inline dropbear_f64x2 dropbear_f64x2_mul(dropbear_f64x2 a, dropbear_f64x2 b) {
+    return dropbear_f64x2_set(a.lanes[0] * b.lanes[0], a.lanes[1] * b.lanes[1]);
+}
+// acc + a * b
+static inline dropbear_f64x2 dropbear_f64x2_fma(dropbear_f64x2 acc, dropbear_f64x2 a, dropbear_f64x2 b) {
+    return dropbear_f64x2_set(acc.lanes[0] + a.lanes[0] * b.lanes[0],
+                              acc.lanes[1] + a.lanes[1] * b.lanes[1]);
+}
+
+#endif
+
+// ===========================================
+
+// out = a * b (Hamilton product, glam operand order). Quaternions are four-double
+// (x, y, z, w) arrays, i.e. pass `&t->rotation_x` directly. `out` may alias either input.
+static inline void dropbear_quat_mul(const double* a, const double* b, double* out) {
+    const double ax = a[0], ay = a[1], az = a[2], aw = a[3];
+
+    // x = aw*bx + ax*bw + ay*bz - az*by
+    // y = aw*by + ay*bw + az*bx - ax*bz
+    dropbear_f64x2 xy = dropbear_f64x2_mul(dropbear_f64x2_splat(aw), dropbear_f64x2_load(b));
+    xy = dropbear_f64x2_fma(xy, dropbear_f64x2_set(ax, ay), dropbear_f64x2_splat(b[3]));
+    xy = dropbear_f64x2_fma(xy, dropbear_f64x2_set(ay, az), dropbear_f64x2_set(b[2], b[0]));
+    xy = dropbear_f64x2_sub(xy, dropbear_f64x2_mul(dropbear_f64x2_set(az, ax), dropbear_f64x2_set(b[1], b[2])));
+
+    // z = aw*bz + az*bw + ax*by - ay*bx
+    // w = aw*bw - az*bz - ax*bx - ay*by
+    dropbear_f64x2 zw = dropbear_f64x2_mul(dropbear_f64x2_splat(aw), dropbear_f64x2_load(b + 2));
+    zw = dropbear_f64x2_fma(zw, dropbear_f64x2_set(az, -az), dropbear_f64x2_set(b[3], b[2]));
+    zw = dropbear_f64x2_fma(zw, dropbear_f64x2_set(ax, -ax), dropbear_f64x2_set(b[1], b[0]));
+    zw = dropbear_f64x2_sub(zw, dropbear_f64x2_mul(dropbear_f64x2_set(ay, ay), dropbear_f64x2_set(b[0], b[1])));
+
+    dropbear_f64x2_store(out, xy);
+    dropbear_f64x2_store(out + 2, zw);
+}
+
+// out = q (four doubles, xyzw) rotated onto v (three doubles), for a unit quaternion q. `out` may alias `v`.
+static inline void dropbear_quat_rotate_vec3(const double* q, const double* v, double* out) {
+    const double qx = q[0], qy = q[1], qz = q[2], qw = q[3];
+
+    // t = 2 * cross(q.xyz, v); v' = v + qw*t + cross(q.xyz, t)
+    const double tx = 2.0 * (qy * v[2] - qz * v[1]);
+    const double ty = 2.0 * (qz * v[0] - qx * v[2]);
+    const double tz = 2.0 * (qx * v[1] - qy * v[0]);
+
+    dropbear_f64x2 xy = dropbear_f64x2_load(v);
+    xy = dropbear_f64x2_fma(xy, dropbear_f64x2_splat(qw), dropbear_f64x2_set(tx, ty));
+    xy = dropbear_f64x2_fma(xy, dropbear_f64x2_set(qy, qz), dropbear_f64x2_set(tz, tx));
+    xy = dropbear_f64x2_sub(xy, dropbear_f64x2_mul(dropbear_f64x2_set(qz, qx), dropbear_f64x2_set(ty, tz)));
+
+    const double rz = v[2] + qw * tz + (qx * ty - qy * tx);
+    dropbear_f64x2_store(out, xy);
+    out[2] = rz;
+}
+
+// out = parent ⊗ local, matching the engine's hierarchy propagation:
+//   position = parent.position + parent.rotation * (local.position * parent.scale)
+//   rotation = parent.rotation * local.rotation
+//   scale    = parent.scale * local.scale
+// `out` may alias either input.
+static inline void dropbear_transform_compose(const NativeTransform* parent,
+                                              const NativeTransform* local,
+                                              NativeTransform* out) {
+    double scaled[3];
+    dropbear_f64x2_store(scaled, dropbear_f64x2_mul(dropbear_f64x2_load(&local->position_x),
+                                                    dropbear_f64x2_load(&parent->scale_x)));
+    scaled[2] = local->position_z * parent->scale_z;
+
+    double rotated[3];
+    dropbear_quat_rotate_vec3(&parent->rotation_x, scaled, rotated);
+
+    double rotation[4];
+    dropbear_quat_mul(&parent->rotation_x, &local->rotation_x, rotation);
+
+    dropbear_f64x2 pos_xy = dropbear_f64x2_add(dropbear_f64x2_load(&parent->position_x),
+                                               dropbear_f64x2_load(rotated));
+    const double pos_z = parent->position_z + rotated[2];
+    dropbear_f64x2 scale_xy = dropbear_f64x2_mul(dropbear_f64x2_load(&parent->scale_x),
+                                                 dropbear_f64x2_load(&local->scale_x));
+    const double scale_z = parent->scale_z * local->scale_z;
+
+    dropbear_f64x2_store(&out->position_x, pos_xy);
+    out->position_z = pos_z;
+    dropbear_f64x2_store(&out->rotation_x, dropbear_f64x2_load(rotation));
+    dropbear_f64x2_store(&out->rotation_z, dropbear_f64x2_load(rotation + 2));
+    dropbear_f64x2_store(&out->scale_x, scale_xy);
+    out->scale_z = scale_z;
+}
+
+// out = lerp(a, b, t): position and scale linearly, rotation by normalized lerp
+// taking the shortest arc. t is unclamped; `out` may alias either input. This is
+// the hot loop for interpolating snapshots of many transforms — it is branch-free
+// apart from the hemisphere flip and touches each field once.
+static inline void dropbear_transform_lerp(const NativeTransform* a,
+                                           const NativeTransform* b,
+                                           double t,
+                                           NativeTransform* out) {
+    const dropbear_f64x2 tt = dropbear_f64x2_splat(t);
+
+    dropbear_f64x2 pos_a = dropbear_f64x2_load(&a->position_x);
+    dropbear_f64x2 pos_xy = dropbear_f64x2_fma(
+        pos_a, dropbear_f64x2_sub(dropbear_f64x2_load(&b->position_x), pos_a), tt);
+    const double pos_z = a->position_z + (b->position_z - a->position_z) * t;
+
+    dropbear_f64x2 scale_a = dropbear_f64x2_load(&a->scale_x);
+    dropbear_f64x2 scale_xy = dropbear_f64x2_fma(
+        scale_a, dropbear_f64x2_sub(dropbear_f64x2_load(&b->scale_x), scale_a), tt);
+    const double scale_z = a->scale_z + (b->scale_z - a->scale_z) * t;
+
+    // nlerp: flip b onto a's hemisphere, lerp component-wise, renormalize.
+    const double dot = a->rotation_x * b->rotation_x + a->rotation_y * b->rotation_y
+        + a->rotation_z * b->rotation_z + a->rotation_w * b->rotation_w;
+    const double sign = dot < 0.0 ? -1.0 : 1.0;
+    const dropbear_f64x2 ss = dropbear_f64x2_splat(sign);
+
+    dropbear_f64x2 rot_a_xy = dropbear_f64x2_load(&a->rotation_x);
+    dropbear_f64x2 rot_a_zw = dropbear_f64x2_load(&a->rotation_z);
+    dropbear_f64x2 rot_xy = dropbear_f64x2_fma(
+        rot_a_xy,
+        dropbear_f64x2_sub(dropbear_f64x2_mul(dropbear_f64x2_load(&b->rotation_x), ss), rot_a_xy),
+        tt);
+    dropbear_f64x2 rot_zw = dropbear_f64x2_fma(
+        rot_a_zw,
+        dropbear_f64x2_sub(dropbear_f64x2_mul(dropbear_f64x2_load(&b->rotation_z), ss), rot_a_zw),
+        tt);
+
+    double rot[4];
+    dropbear_f64x2_store(rot, rot_xy);
+    dropbear_f64x2_store(rot + 2, rot_zw);
+    const double len_sq = rot[0] * rot[0] + rot[1] * rot[1] + rot[2] * rot[2] + rot[3] * rot[3];
+    const double inv_len = len_sq > 0.0 ? 1.0 / sqrt(len_sq) : 0.0;
+    const dropbear_f64x2 inv = dropbear_f64x2_splat(inv_len);
+
+    dropbear_f64x2_store(&out->position_x, pos_xy);
+    out->position_z = pos_z;
+    dropbear_f64x2_store(&out->rotation_x, dropbear_f64x2_mul(rot_xy, inv));
+    dropbear_f64x2_store(&out->rotation_z, dropbear_f64x2_mul(rot_zw, inv));
+    dropbear_f64x2_store(&out->scale_x, scale_xy);
+    out->scale_z = scale_z;
+}
+
+// ===========================================
+
+#endif // DROPBEAR_MATH_H